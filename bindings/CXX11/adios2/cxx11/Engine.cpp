@@ -70,6 +70,16 @@ size_t Engine::CurrentStep() const
     return m_Engine->CurrentStep();
 }
 
+size_t Engine::DrainedSteps() const
+{
+    helper::CheckForNullptr(m_Engine, "in call to Engine::DrainedSteps");
+    if (m_Engine->m_EngineType == "NULL")
+    {
+        return 0;
+    }
+    return m_Engine->DrainedSteps();
+}
+
 void Engine::PerformPuts()
 {
     helper::CheckForNullptr(m_Engine, "in call to Engine::PerformPuts");
@@ -90,6 +90,14 @@ public:
      */
     size_t CurrentStep() const;
 
+    /**
+     * Inspect how many steps written by this process have reached the target
+     * file system when writing through a burst buffer (e.g. BP4
+     * BurstBufferPath). Does not block.
+     * @return number of steps fully drained
+     */
+    size_t DrainedSteps() const;
+
     /**
      * Put signature that provides access to the internal engine buffer for a
      * pre-allocated variable including a fill value. Returns a fixed size Span
@@ -342,6 +342,32 @@ else()
   set(ADIOS2_HAVE_SysVShMem OFF)
 endif()
 
+#Asynchronous file I/O
+if(UNIX AND ADIOS2_USE_AIO)
+  include(CheckSymbolExists)
+  include(CheckLibraryExists)
+  CHECK_LIBRARY_EXISTS(rt lio_listio "" HAVE_rt_lio_listio)
+  if(HAVE_rt_lio_listio)
+    set(ADIOS2_AIO_LIBRARIES rt)
+  endif()
+  set(CMAKE_REQUIRED_LIBRARIES ${ADIOS2_AIO_LIBRARIES})
+  CHECK_SYMBOL_EXISTS(lio_listio "aio.h" HAVE_lio_listio)
+  unset(CMAKE_REQUIRED_LIBRARIES)
+  if(HAVE_lio_listio)
+    set(ADIOS2_HAVE_AIO ON)
+    # io_uring is used through system calls, liburing is not needed
+    CHECK_SYMBOL_EXISTS(IORING_OFF_SQ_RING "linux/io_uring.h" HAVE_IORING_OFF_SQ_RING)
+    CHECK_SYMBOL_EXISTS(__NR_io_uring_setup "sys/syscall.h" HAVE_io_uring_setup)
+    if(HAVE_IORING_OFF_SQ_RING AND HAVE_io_uring_setup)
+      set(ADIOS2_AIO_HAVE_IO_URING TRUE)
+    endif()
+  elseif(ADIOS2_USE_AIO STREQUAL ON)
+    message(FATAL_ERROR "POSIX AIO (aio.h) is required for ADIOS2_USE_AIO=ON")
+  endif()
+else()
+  set(ADIOS2_HAVE_AIO OFF)
+endif()
+
 #Profiling
 if(ADIOS2_USE_Profiling STREQUAL AUTO)
   if(BUILD_SHARED_LIBS)
@@ -183,10 +183,17 @@ constexpr uint64_t DefaultMaxBufferSize = MaxSizeT - 1;
  * for optimizing applications*/
 constexpr float DefaultBufferGrowthFactor = 1.05f;
 
+/** default size of each chunk in chunked buffers, 16Mb, in bytes */
+constexpr size_t DefaultBufferChunkSize = 16 * 1024 * 1024;
+
 /** default size for writing/reading files using POSIX/fstream/stdio write
  *  2Gb - 100Kb (tolerance)*/
 constexpr size_t DefaultMaxFileBatchSize = 2147381248;
 
+/** file offset, size and memory alignment of direct (O_DIRECT) writes, a
+ * multiple of the logical block size of most devices */
+constexpr size_t DefaultDirectIOAlignment = 4096;
+
 constexpr char PathSeparator =
 #ifdef _WIN32
     '\\';
@@ -60,6 +60,12 @@ size_t Engine::CurrentStep() const
     return 0;
 }
 
+size_t Engine::DrainedSteps() const
+{
+    ThrowUp("DrainedSteps");
+    return 0;
+}
+
 void Engine::EndStep() { ThrowUp("EndStep"); }
 void Engine::PerformPuts() { ThrowUp("PerformPuts"); }
 void Engine::PerformGets() { ThrowUp("PerformGets"); }
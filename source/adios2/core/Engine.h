@@ -102,6 +102,13 @@ public:
      */
     virtual size_t CurrentStep() const;
 
+    /**
+     * Returns the number of steps written by this process that reached their
+     * final target, for engines draining a burst buffer. Does not block.
+     * @return steps fully drained
+     */
+    virtual size_t DrainedSteps() const;
+
     /**
      * Put signature that pre-allocates a Variable in Buffer returning a Span of
      * the payload memory from variable.m_Count
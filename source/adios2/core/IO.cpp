@@ -303,7 +303,14 @@ void IO::SetTransportParameter(const size_t transportIndex,
     m_TransportsParameters[transportIndex][key] = value;
 }
 
-const VarMap &IO::GetVariables() const noexcept { return m_Variables; }
+const VarMap &IO::GetVariables() const noexcept
+{
+    if (m_DefineLazyVariable)
+    {
+        m_DefineLazyVariable("");
+    }
+    return m_Variables;
+}
 
 const AttrMap &IO::GetAttributes() const noexcept { return m_Attributes; }
 
@@ -370,7 +377,7 @@ IO::GetAvailableVariables(const std::set<std::string> &keys) noexcept
     TAU_SCOPED_TIMER("IO::GetAvailableVariables");
 
     std::map<std::string, Params> variablesInfo;
-    for (const auto &variablePair : m_Variables)
+    for (const auto &variablePair : GetVariables())
     {
         const std::string variableName = variablePair.first;
         const DataType type = InquireVariableType(variableName);
@@ -400,7 +407,7 @@ IO::GetAvailableAttributes(const std::string &variableName,
 
     if (!variableName.empty())
     {
-        auto itVariable = m_Variables.find(variableName);
+        auto itVariable = FindVariable(variableName);
         const DataType type = InquireVariableType(itVariable);
 
         if (type == DataType::Compound)
@@ -433,7 +440,7 @@ IO::GetAvailableAttributes(const std::string &variableName,
 DataType IO::InquireVariableType(const std::string &name) const noexcept
 {
     TAU_SCOPED_TIMER("IO::other");
-    auto itVariable = m_Variables.find(name);
+    auto itVariable = FindVariable(name);
     return InquireVariableType(itVariable);
 }
 
@@ -762,6 +769,17 @@ void IO::SetPrefixedNames(const bool isStep) noexcept
 }
 
 // PRIVATE
+VarMap::const_iterator IO::FindVariable(const std::string &name) const
+{
+    auto itVariable = m_Variables.find(name);
+    if (itVariable == m_Variables.end() && m_DefineLazyVariable &&
+        m_DefineLazyVariable(name))
+    {
+        itVariable = m_Variables.find(name);
+    }
+    return itVariable;
+}
+
 void IO::CheckAttributeCommon(const std::string &name) const
 {
     auto itAttribute = m_Attributes.find(name);
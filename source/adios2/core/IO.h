@@ -12,6 +12,7 @@
 #define ADIOS2_CORE_IO_H_
 
 /// \cond EXCLUDE_FROM_DOXYGEN
+#include <functional> //std::function
 #include <map>
 #include <memory> //std:shared_ptr
 #include <string>
@@ -94,6 +95,13 @@ public:
      *   when function m_IsPrefixedNames called */
     bool m_IsPrefixedNames = false;
 
+    /**
+     * Set by reader engines that define variables lazily, on first use.
+     * Called with the name of a variable not found in this IO, returns true
+     * if the engine defined it. An empty name defines all remaining variables.
+     */
+    std::function<bool(const std::string &)> m_DefineLazyVariable;
+
     /**
      * @brief Constructor called from ADIOS factory class DeclareIO function.
      * Not to be used direclty in applications.
@@ -501,6 +509,14 @@ private:
 
     std::map<std::string, std::shared_ptr<Engine>> m_Engines;
 
+    /**
+     * Finds a variable in m_Variables, if not found asks the reader engine to
+     * define it in case it is lazily defined (m_DefineLazyVariable)
+     * @param name input variable name
+     * @return iterator to variable, or m_Variables.end() if not found
+     */
+    VarMap::const_iterator FindVariable(const std::string &name) const;
+
     /** Checks if attribute exists, called from DefineAttribute different
      *  signatures */
     void CheckAttributeCommon(const std::string &name) const;
@@ -72,7 +72,7 @@ template <class T>
 Variable<T> *IO::InquireVariable(const std::string &name) noexcept
 {
     TAU_SCOPED_TIMER("IO::InquireVariable");
-    auto itVariable = m_Variables.find(name);
+    auto itVariable = FindVariable(name);
 
     if (itVariable == m_Variables.end())
     {
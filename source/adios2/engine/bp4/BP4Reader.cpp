@@ -33,6 +33,14 @@ BP4Reader::BP4Reader(IO &io, const std::string &name, const Mode mode,
     Init();
 }
 
+BP4Reader::~BP4Reader()
+{
+    if (m_BP4Deserializer.m_Parameters.LazyVariables)
+    {
+        m_IO.m_DefineLazyVariable = nullptr;
+    }
+}
+
 StepStatus BP4Reader::BeginStep(StepMode mode, const float timeoutSeconds)
 {
     TAU_SCOPED_TIMER("BP4Reader::BeginStep");
@@ -52,6 +60,10 @@ StepStatus BP4Reader::BeginStep(StepMode mode, const float timeoutSeconds)
             "PerformGets() or EndStep()?, in call to BeginStep\n");
     }
 
+    // streaming works on all variables, and new steps replace the metadata
+    // buffer lazy variables point to
+    m_BP4Deserializer.DefineLazyVariables(*this);
+
     // used to inquire for variables in streaming mode
     m_IO.m_ReadStreaming = true;
     StepStatus status = StepStatus::OK;
@@ -152,6 +164,17 @@ void BP4Reader::Init()
     m_BP4Deserializer.Init(m_IO.m_Parameters, "in call to BP4::Open to write");
     InitTransports();
 
+    if (m_BP4Deserializer.m_Parameters.NodeBroadcast)
+    {
+        m_NodeComm = m_Comm.GroupByShm("creating node communicator for "
+                                       "NodeBroadcast in call to BP4::Open");
+        // rank 0 is the first process of its node and the first leader
+        m_NodeLeadersComm = m_Comm.Split(
+            m_NodeComm.Rank() == 0 ? 0 : 1, m_Comm.Rank(),
+            "creating node leaders communicator for NodeBroadcast in call "
+            "to BP4::Open");
+    }
+
     /* Do a collective wait for the file(s) to appear within timeout.
        Make sure every process comes to the same conclusion */
     const Seconds timeoutSeconds =
@@ -409,7 +432,8 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
                            const Seconds &pollSeconds,
                            const Seconds &timeoutSeconds)
 {
-    size_t newIdxSize = 0;
+    // md.idx and md.0 sizes
+    std::vector<size_t> sizes(2, 0);
     // Put all metadata in buffer
     if (m_BP4Deserializer.m_RankMPI == 0)
     {
@@ -450,7 +474,8 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
                     expectedMinFileSize);
                 m_MDFileAlreadyReadSize = expectedMinFileSize;
                 m_MDIndexFileAlreadyReadSize = metadataIndexFileSize;
-                newIdxSize = metadataIndexFileSize;
+                sizes[0] = metadataIndexFileSize;
+                sizes[1] = expectedMinFileSize;
             }
             else
             {
@@ -470,15 +495,17 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
         }
     }
 
-    newIdxSize = m_Comm.BroadcastValue(newIdxSize, 0);
+    m_Comm.BroadcastVector(sizes, 0);
+    const size_t newIdxSize = sizes[0];
 
     if (newIdxSize > 0)
     {
         // broadcast buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_BP4Deserializer.m_Metadata.m_Buffer);
+        BroadcastMetadata(m_BP4Deserializer.m_Metadata.m_Buffer, sizes[1]);
 
         // broadcast metadata index buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_BP4Deserializer.m_MetadataIndex.m_Buffer);
+        BroadcastMetadata(m_BP4Deserializer.m_MetadataIndex.m_Buffer,
+                          newIdxSize);
 
         /* Parse metadata index table */
         m_BP4Deserializer.ParseMetadataIndex(m_BP4Deserializer.m_MetadataIndex,
@@ -487,9 +514,39 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
         // done
         m_IdxHeaderParsed = true;
 
+        std::vector<char> metadataCache;
+        if (m_BP4Deserializer.m_Parameters.MetadataCache)
+        {
+            metadataCache = ReadMetadataCache();
+        }
+
         // fills IO with Variables and Attributes
         m_MDFileProcessedSize = m_BP4Deserializer.ParseMetadata(
-            m_BP4Deserializer.m_Metadata, *this, true);
+            m_BP4Deserializer.m_Metadata, *this, true, metadataCache.empty());
+
+        if (!metadataCache.empty())
+        {
+            m_BP4Deserializer.DefineVariablesFromMetadataCache(*this,
+                                                               metadataCache);
+        }
+        else if (m_BP4Deserializer.m_Parameters.MetadataCache &&
+                 !m_BP4Deserializer.m_Parameters.LazyVariables)
+        {
+            WriteMetadataCache();
+        }
+
+        if (m_BP4Deserializer.m_Parameters.LazyVariables)
+        {
+            // variables are defined by IO when they are used the first time
+            m_IO.m_DefineLazyVariable = [this](const std::string &name) {
+                if (name.empty())
+                {
+                    m_BP4Deserializer.DefineLazyVariables(*this);
+                    return true;
+                }
+                return m_BP4Deserializer.DefineLazyVariable(*this, name);
+            };
+        }
 
         /* m_MDFileProcessedSize is the position in the buffer where processing
          * ends. The processing is controlled by the number of records in the
@@ -504,6 +561,67 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
     }
 }
 
+std::vector<char> BP4Reader::ReadMetadataCache()
+{
+    std::vector<char> cache;
+    if (m_BP4Deserializer.m_RankMPI == 0)
+    {
+        const std::string cacheFile(
+            m_BP4Deserializer.GetBPMetadataCacheFileName(m_Name));
+        transportman::TransportMan cacheFileManager(m_Comm);
+        try
+        {
+            cacheFileManager.OpenFiles({cacheFile}, Mode::Read,
+                                       {{{"transport", "File"}}}, false);
+            const size_t cacheSize = cacheFileManager.GetFileSize(0);
+            cache.resize(cacheSize);
+            cacheFileManager.ReadFile(cache.data(), cacheSize);
+            cacheFileManager.CloseFiles();
+        }
+        catch (std::exception &)
+        {
+            // no cache yet
+            cache.clear();
+        }
+
+        if (!m_BP4Deserializer.IsValidMetadataCache(cache))
+        {
+            cache.clear();
+        }
+    }
+
+    m_Comm.BroadcastVector(cache);
+    return cache;
+}
+
+void BP4Reader::WriteMetadataCache()
+{
+    // metadata of a file still being written is not final
+    if (m_BP4Deserializer.m_RankMPI != 0 ||
+        m_BP4Deserializer.m_WriterIsActive)
+    {
+        return;
+    }
+
+    const std::vector<char> cache =
+        m_BP4Deserializer.SerializeMetadataCache(m_IO);
+
+    const std::string cacheFile(
+        m_BP4Deserializer.GetBPMetadataCacheFileName(m_Name));
+    transportman::TransportMan cacheFileManager(m_Comm);
+    try
+    {
+        cacheFileManager.OpenFiles({cacheFile}, Mode::Write,
+                                   {{{"transport", "File"}}}, false);
+        cacheFileManager.WriteFiles(cache.data(), cache.size());
+        cacheFileManager.CloseFiles();
+    }
+    catch (std::exception &)
+    {
+        // cache is optional, it is created again by the next reader
+    }
+}
+
 size_t BP4Reader::UpdateBuffer(const TimePoint &timeoutInstant,
                                const Seconds &pollSeconds)
 {
@@ -602,19 +720,57 @@ size_t BP4Reader::UpdateBuffer(const TimePoint &timeoutInstant,
             // for parsing it correctly in ProcessMetadataForNewSteps()
         }
 
-        // broadcast buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_BP4Deserializer.m_Metadata.m_Buffer);
+        // broadcast new metadata to all ranks from zero, buffers may be
+        // larger than the new content from previous steps
+        BroadcastMetadata(m_BP4Deserializer.m_Metadata.m_Buffer,
+                          m_MDFileAlreadyReadSize - m_MDFileAbsolutePos);
 
         // broadcast metadata index buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_BP4Deserializer.m_MetadataIndex.m_Buffer);
+        BroadcastMetadata(m_BP4Deserializer.m_MetadataIndex.m_Buffer,
+                          newIdxSize);
     }
     return newIdxSize;
 }
+
+void BP4Reader::BroadcastMetadata(std::vector<char> &buffer, const size_t size)
+{
+    if (buffer.size() < size)
+    {
+        buffer.resize(size);
+    }
+
+    if (m_BP4Deserializer.m_Parameters.NodeBroadcast)
+    {
+        if (m_NodeComm.Rank() == 0)
+        {
+            m_NodeLeadersComm.Bcast(buffer.data(), size, 0,
+                                    "broadcasting metadata to nodes in call "
+                                    "to BP4::Open or BeginStep");
+        }
+        m_NodeComm.Bcast(buffer.data(), size, 0,
+                         "broadcasting metadata in node in call to "
+                         "BP4::Open or BeginStep");
+    }
+    else
+    {
+        m_Comm.Bcast(buffer.data(), size, 0,
+                     "broadcasting metadata in call to BP4::Open or "
+                     "BeginStep");
+    }
+}
 void BP4Reader::ProcessMetadataForNewSteps(const size_t newIdxSize)
 {
-    /* Remove all existing variables from previous steps
-       It seems easier than trying to update them */
-    m_IO.RemoveAllVariables();
+    /* Keep existing variables from previous steps, only their block index
+       offsets into the old metadata buffer are dropped. Parsing the new steps
+       then resets and reuses the same Variable objects instead of defining
+       all of them again */
+    for (const auto &variablePair : m_IO.GetVariables())
+    {
+        VariableBase &variable = *variablePair.second;
+        variable.m_AvailableStepBlockIndexOffsets.clear();
+        variable.m_AvailableShapes.clear();
+        variable.m_AvailableStepsCount = 0;
+    }
 
     /* Parse metadata index table (without header) */
     /* We need to skew the index table pointers with the
@@ -629,6 +785,20 @@ void BP4Reader::ProcessMetadataForNewSteps(const size_t newIdxSize)
     const size_t newProcessedMDSize = m_BP4Deserializer.ParseMetadata(
         m_BP4Deserializer.m_Metadata, *this, false);
 
+    // remove variables that do not exist in the new steps
+    std::vector<std::string> removedVariables;
+    for (const auto &variablePair : m_IO.GetVariables())
+    {
+        if (variablePair.second->m_AvailableStepBlockIndexOffsets.empty())
+        {
+            removedVariables.push_back(variablePair.first);
+        }
+    }
+    for (const std::string &name : removedVariables)
+    {
+        m_IO.RemoveVariable(name);
+    }
+
     // remember current end position in metadata and index table for next round
     m_MDFileProcessedSize = m_MDFileAbsolutePos + newProcessedMDSize;
     // if (m_BP4Deserializer.m_RankMPI == 0)
@@ -763,6 +933,15 @@ void BP4Reader::DoClose(const int transportIndex)
     PerformGets();
     m_DataFileManager.CloseFiles();
     m_MDFileManager.CloseFiles();
+    if (m_BP4Deserializer.m_Parameters.LazyVariables)
+    {
+        m_IO.m_DefineLazyVariable = nullptr;
+    }
+    if (m_BP4Deserializer.m_Parameters.NodeBroadcast)
+    {
+        m_NodeLeadersComm.Free("freeing node leaders comm at Close");
+        m_NodeComm.Free("freeing node comm at Close");
+    }
 }
 
 #define declare_type(T)                                                        \
@@ -40,7 +40,7 @@ public:
     BP4Reader(IO &io, const std::string &name, const Mode mode,
               helper::Comm comm);
 
-    virtual ~BP4Reader() = default;
+    virtual ~BP4Reader();
 
     StepStatus BeginStep(StepMode mode = StepMode::Read,
                          const float timeoutSeconds = -1.0) final;
@@ -86,6 +86,11 @@ private:
     transportman::TransportMan m_ActiveFlagFileManager;
     bool m_WriterIsActive = true;
 
+    /* processes of the same compute node, and first process of each node,
+     * used for broadcasting metadata with the NodeBroadcast parameter */
+    helper::Comm m_NodeComm;
+    helper::Comm m_NodeLeadersComm;
+
     /** used for per-step reads, TODO: to be moved to BP4Deserializer */
     size_t m_CurrentStep = 0;
     bool m_FirstStep = true;
@@ -118,6 +123,24 @@ private:
     void InitBuffer(const TimePoint &timeoutInstant, const Seconds &pollSeconds,
                     const Seconds &timeoutSeconds);
 
+    /** Broadcast metadata read by rank 0 to all ranks, either directly or
+     *  through one rank per compute node with NodeBroadcast
+     *  @param buffer: input on rank 0, resized if smaller on other ranks
+     *  @param size: bytes to broadcast from the beginning of buffer
+     */
+    void BroadcastMetadata(std::vector<char> &buffer, const size_t size);
+
+    /** Read the metadata cache file (md.cache) on rank 0 and broadcast it.
+     *  @return cache content, empty if it does not exist or it is outdated
+     */
+    std::vector<char> ReadMetadataCache();
+
+    /** Write the metadata cache file (md.cache) on rank 0 after all metadata
+     *  of a closed file is parsed. Errors are ignored, e.g. on read-only
+     *  file systems, since the cache is optional.
+     */
+    void WriteMetadataCache();
+
     /** Read in more metadata if exist (throwing away old).
      *  For streaming only.
      *  @return size of new content from Index Table
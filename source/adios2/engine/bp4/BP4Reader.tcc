@@ -15,6 +15,9 @@
 
 #include "adios2/helper/adiosFunctions.h"
 
+#include <algorithm> //std::sort
+#include <future>
+
 namespace adios2
 {
 namespace core
@@ -63,11 +66,152 @@ void BP4Reader::GetDeferredCommon(Variable<T> &variable, T *data)
 template <class T>
 void BP4Reader::ReadVariableBlocks(Variable<T> &variable)
 {
+    /** boxes in the same substream at most this many bytes apart are read
+     * with a single call to the transport manager */
+    constexpr size_t maxReadGapSize = 4096;
+    /** coalescing stops when a single read would become larger */
+    constexpr size_t maxCoalescedReadSize = 16 * 1024 * 1024;
+    /** asynchronous transports: reads in flight while boxes are processed */
+    constexpr size_t maxReadsInFlight = 4;
+
+    /** a single box (block) read request for one step */
+    struct BoxRead
+    {
+        typename Variable<T>::Info *BlockInfo;
+        const helper::SubStreamBoxInfo *SubStreamBoxInfo;
+        T *Data;
+        size_t PayloadOffset;
+        size_t PayloadSize;
+    };
+
+    /** boxes [First, Last) covered by a single read of [Start, End) */
+    struct CoalescedRead
+    {
+        size_t First;
+        size_t Last;
+        size_t Start;
+        size_t End;
+    };
+
+    auto lf_ReadSubStream = [&](std::vector<BoxRead> &boxReads,
+                                const size_t subStreamID,
+                                std::vector<std::vector<char>> &buffers,
+                                const size_t threadID, const bool isRowMajor) {
+        std::vector<CoalescedRead> reads;
+        size_t first = 0;
+        while (first < boxReads.size())
+        {
+            // extend the current read over boxes that are (nearly) adjacent
+            const size_t readStart = boxReads[first].PayloadOffset;
+            size_t readEnd = readStart + boxReads[first].PayloadSize;
+            size_t last = first + 1;
+            while (last < boxReads.size())
+            {
+                const BoxRead &next = boxReads[last];
+                const size_t nextEnd =
+                    std::max(readEnd, next.PayloadOffset + next.PayloadSize);
+                if (next.PayloadOffset > readEnd + maxReadGapSize ||
+                    nextEnd - readStart > maxCoalescedReadSize)
+                {
+                    break;
+                }
+                readEnd = nextEnd;
+                ++last;
+            }
+            reads.push_back({first, last, readStart, readEnd});
+            first = last;
+        }
+
+        auto lf_PostDataRead = [&](const CoalescedRead &read,
+                                   const char *readData) {
+            for (size_t b = read.First; b < read.Last; ++b)
+            {
+                const BoxRead &boxRead = boxReads[b];
+                m_BP4Deserializer.PostDataRead(
+                    variable, *boxRead.BlockInfo, *boxRead.SubStreamBoxInfo,
+                    isRowMajor, readData + (boxRead.PayloadOffset - read.Start),
+                    boxRead.Data, threadID);
+            }
+        };
+
+        if (!m_DataFileManager.AsyncFiles(static_cast<int>(subStreamID)))
+        {
+            std::vector<char> &buffer = buffers[0];
+            for (const CoalescedRead &read : reads)
+            {
+                // memory mapped transports give access without a copy
+                const char *readData = m_DataFileManager.MappedFileData(
+                    read.End - read.Start, read.Start, subStreamID);
+                if (readData == nullptr)
+                {
+                    buffer.resize(read.End - read.Start);
+                    m_DataFileManager.ReadFile(buffer.data(), buffer.size(),
+                                               read.Start, subStreamID);
+                    readData = buffer.data();
+                }
+                lf_PostDataRead(read, readData);
+            }
+            return;
+        }
+
+        // the next reads are in flight while the current one is processed
+        std::vector<Transport::Status> statuses(maxReadsInFlight);
+        size_t issued = 0;
+        auto lf_IRead = [&]() {
+            const CoalescedRead &read = reads[issued];
+            std::vector<char> &buffer = buffers[issued % maxReadsInFlight];
+            buffer.resize(read.End - read.Start);
+            m_DataFileManager.IReadFile(buffer.data(), buffer.size(),
+                                        statuses[issued % maxReadsInFlight],
+                                        read.Start, subStreamID);
+            ++issued;
+        };
+
+        size_t completed = 0;
+        try
+        {
+            while (issued < reads.size() && issued < maxReadsInFlight)
+            {
+                lf_IRead();
+            }
+
+            for (; completed < reads.size(); ++completed)
+            {
+                const size_t slot = completed % maxReadsInFlight;
+                m_DataFileManager.WaitFile(statuses[slot], subStreamID);
+                lf_PostDataRead(reads[completed], buffers[slot].data());
+                if (issued < reads.size())
+                {
+                    lf_IRead();
+                }
+            }
+        }
+        catch (...)
+        {
+            // buffers must outlive the reads still in flight
+            for (; completed < issued; ++completed)
+            {
+                try
+                {
+                    m_DataFileManager.WaitFile(
+                        statuses[completed % maxReadsInFlight], subStreamID);
+                }
+                catch (...)
+                {
+                }
+            }
+            throw;
+        }
+    };
+
     const bool profile = m_BP4Deserializer.m_Profiler.m_IsActive;
 
+    // gather all pending box reads for this variable per substream
+    std::map<size_t, std::vector<BoxRead>> subStreamsReads;
+
     for (typename Variable<T>::Info &blockInfo : variable.m_BlocksInfo)
     {
-        T *originalBlockData = blockInfo.Data;
+        T *stepData = blockInfo.Data;
 
         for (const auto &stepPair : blockInfo.StepBlockSubStreamsInfo)
         {
@@ -88,30 +232,94 @@ void BP4Reader::ReadVariableBlocks(Variable<T> &variable)
                             m_Name, subStreamBoxInfo.SubStreamID,
                             m_BP4Deserializer.m_Minifooter.HasSubFiles, true);
 
+                    // striped data files are reassembled by their transport
+                    Params parameters = m_IO.m_TransportsParameters.front();
+                    if (m_BP4Deserializer.m_StripedData)
+                    {
+                        parameters.erase("library");
+                        parameters["Library"] = "stripe";
+                    }
+
                     m_DataFileManager.OpenFileID(
                         subFileName, subStreamBoxInfo.SubStreamID, Mode::Read,
-                        {{"transport", "File"}}, profile);
+                        parameters, profile);
                 }
 
-                char *buffer = nullptr;
-                size_t payloadSize = 0, payloadStart = 0;
+                BoxRead boxRead;
+                boxRead.BlockInfo = &blockInfo;
+                boxRead.SubStreamBoxInfo = &subStreamBoxInfo;
+                boxRead.Data = stepData;
+                m_BP4Deserializer.GetPayloadRange(subStreamBoxInfo,
+                                                  boxRead.PayloadSize,
+                                                  boxRead.PayloadOffset);
 
-                m_BP4Deserializer.PreDataRead(variable, blockInfo,
-                                              subStreamBoxInfo, buffer,
-                                              payloadSize, payloadStart, 0);
-
-                m_DataFileManager.ReadFile(buffer, payloadSize, payloadStart,
-                                           subStreamBoxInfo.SubStreamID);
-
-                m_BP4Deserializer.PostDataRead(
-                    variable, blockInfo, subStreamBoxInfo,
-                    helper::IsRowMajor(m_IO.m_HostLanguage), 0);
+                subStreamsReads[subStreamBoxInfo.SubStreamID].push_back(
+                    boxRead);
             } // substreams loop
             // advance pointer to next step
-            blockInfo.Data += helper::GetTotalSize(blockInfo.Count);
+            stepData += helper::GetTotalSize(blockInfo.Count);
         } // steps loop
-        blockInfo.Data = originalBlockData;
-    } // deferred blocks loop
+    }     // deferred blocks loop
+
+    if (subStreamsReads.empty())
+    {
+        return;
+    }
+
+    // sort by file offset so that neighbor boxes can be coalesced
+    std::vector<std::pair<size_t, std::vector<BoxRead> *>> subStreams;
+    subStreams.reserve(subStreamsReads.size());
+    for (auto &subStreamPair : subStreamsReads)
+    {
+        std::vector<BoxRead> &boxReads = subStreamPair.second;
+        std::sort(boxReads.begin(), boxReads.end(),
+                  [](const BoxRead &a, const BoxRead &b) {
+                      return a.PayloadOffset < b.PayloadOffset;
+                  });
+        subStreams.emplace_back(subStreamPair.first, &boxReads);
+    }
+
+    const bool isRowMajor = helper::IsRowMajor(m_IO.m_HostLanguage);
+    const size_t threads =
+        std::min(static_cast<size_t>(m_BP4Deserializer.m_Parameters.Threads),
+                 subStreams.size());
+
+    // each thread owns a queue of substreams, a transport is only accessed
+    // from a single thread
+    auto lf_ReadSubStreams = [&](const size_t threadID) {
+        std::vector<std::vector<char>> buffers(maxReadsInFlight);
+        for (size_t s = threadID; s < subStreams.size(); s += threads)
+        {
+            lf_ReadSubStream(*subStreams[s].second, subStreams[s].first,
+                             buffers, threadID, isRowMajor);
+        }
+    };
+
+    if (threads <= 1)
+    {
+        lf_ReadSubStreams(0);
+        return;
+    }
+
+    // thread buffers must exist before threads start to avoid map insertions
+    for (size_t t = 0; t < threads; ++t)
+    {
+        m_BP4Deserializer.m_ThreadBuffers[t][0];
+    }
+
+    std::vector<std::future<void>> asyncs;
+    asyncs.reserve(threads - 1);
+    for (size_t t = 1; t < threads; ++t)
+    {
+        asyncs.push_back(
+            std::async(std::launch::async, lf_ReadSubStreams, t));
+    }
+    lf_ReadSubStreams(0);
+
+    for (auto &async : asyncs)
+    {
+        async.get();
+    }
 }
 
 } // end namespace engine
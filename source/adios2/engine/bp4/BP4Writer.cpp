@@ -17,6 +17,7 @@
 #include "adios2/toolkit/profiling/taustubs/tautimer.hpp"
 #include "adios2/toolkit/transport/file/FileFStream.h"
 
+#include <algorithm> // std::max, std::swap
 #include <ctime>
 #include <iostream>
 
@@ -31,7 +32,7 @@ BP4Writer::BP4Writer(IO &io, const std::string &name, const Mode mode,
                      helper::Comm comm)
 : Engine("BP4Writer", io, name, mode, std::move(comm)), m_BP4Serializer(m_Comm),
   m_FileDataManager(m_Comm), m_FileMetadataManager(m_Comm),
-  m_FileMetadataIndexManager(m_Comm), m_FileDrainer()
+  m_FileMetadataIndexManager(m_Comm)
 {
     TAU_SCOPED_TIMER("BP4Writer::Open");
     m_IO.m_ReadStreaming = false;
@@ -45,6 +46,7 @@ StepStatus BP4Writer::BeginStep(StepMode mode, const float timeoutSeconds)
     TAU_SCOPED_TIMER("BP4Writer::BeginStep");
     m_BP4Serializer.m_DeferredVariables.clear();
     m_BP4Serializer.m_DeferredVariablesDataSize = 0;
+    m_BP4Serializer.m_DeferredZeroCopyDataSize = 0;
     m_IO.m_ReadStreaming = false;
     return StepStatus::OK;
 }
@@ -54,16 +56,63 @@ size_t BP4Writer::CurrentStep() const
     return m_BP4Serializer.m_MetadataSet.CurrentStep;
 }
 
+size_t BP4Writer::DrainedSteps() const
+{
+    if (m_FileDrainer)
+    {
+        return m_FileDrainer->GetDrainedSteps();
+    }
+    // no burst buffer, or the data is drained by the aggregator
+    return CurrentStep();
+}
+
 void BP4Writer::PerformPuts()
 {
     TAU_SCOPED_TIMER("BP4Writer::PerformPuts");
+    PerformPutsCommon(false);
+}
+
+void BP4Writer::EndStep()
+{
+    TAU_SCOPED_TIMER("BP4Writer::EndStep");
+    const size_t flushStepsCount = m_BP4Serializer.m_Parameters.FlushStepsCount;
+    // data is written before EndStep returns if the next step is flushed
+    const bool flush = (CurrentStep() + 1) % flushStepsCount == 0;
+
+    if (m_BP4Serializer.m_DeferredVariables.size() > 0)
+    {
+        PerformPutsCommon(flush);
+    }
+
+    // true: advances step
+    m_BP4Serializer.SerializeData(m_IO, true);
+
+    if (flush)
+    {
+        FlushCommon(m_BP4Serializer.m_Parameters.AsyncWrite);
+    }
+}
+
+void BP4Writer::Flush(const int transportIndex)
+{
+    TAU_SCOPED_TIMER("BP4Writer::Flush");
+    // an explicit Flush makes all steps written so far available
+    FlushCommon(false, transportIndex);
+}
+
+// PRIVATE
+void BP4Writer::PerformPutsCommon(const bool zeroCopy)
+{
     if (m_BP4Serializer.m_DeferredVariables.empty())
     {
         return;
     }
 
-    m_BP4Serializer.ResizeBuffer(m_BP4Serializer.m_DeferredVariablesDataSize,
-                                 "in call to PerformPuts");
+    // zero-copy payloads don't need space in the data buffer
+    const size_t dataSize =
+        m_BP4Serializer.m_DeferredVariablesDataSize +
+        (zeroCopy ? 0 : m_BP4Serializer.m_DeferredZeroCopyDataSize);
+    m_BP4Serializer.ResizeBuffer(dataSize, "in call to PerformPuts");
 
     for (const std::string &variableName : m_BP4Serializer.m_DeferredVariables)
     {
@@ -77,7 +126,7 @@ void BP4Writer::PerformPuts()
     {                                                                          \
         Variable<T> &variable = FindVariable<T>(                               \
             variableName, "in call to PerformPuts, EndStep or Close");         \
-        PerformPutCommon(variable);                                            \
+        PerformPutCommon(variable, zeroCopy);                                  \
     }
 
         ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_template_instantiation)
@@ -85,48 +134,16 @@ void BP4Writer::PerformPuts()
     }
     m_BP4Serializer.m_DeferredVariables.clear();
     m_BP4Serializer.m_DeferredVariablesDataSize = 0;
+    m_BP4Serializer.m_DeferredZeroCopyDataSize = 0;
 }
 
-void BP4Writer::EndStep()
-{
-    TAU_SCOPED_TIMER("BP4Writer::EndStep");
-    if (m_BP4Serializer.m_DeferredVariables.size() > 0)
-    {
-        PerformPuts();
-    }
-
-    // true: advances step
-    m_BP4Serializer.SerializeData(m_IO, true);
-
-    const size_t currentStep = CurrentStep();
-    const size_t flushStepsCount = m_BP4Serializer.m_Parameters.FlushStepsCount;
-
-    if (currentStep % flushStepsCount == 0)
-    {
-        Flush();
-    }
-}
-
-void BP4Writer::Flush(const int transportIndex)
-{
-    TAU_SCOPED_TIMER("BP4Writer::Flush");
-    DoFlush(false, transportIndex);
-    m_BP4Serializer.ResetBuffer(m_BP4Serializer.m_Data);
-
-    if (m_BP4Serializer.m_Parameters.CollectiveMetadata)
-    {
-        WriteCollectiveMetadataFile();
-    }
-}
-
-// PRIVATE
 void BP4Writer::Init()
 {
     InitParameters();
     if (m_BP4Serializer.m_Parameters.NumAggregators <
         static_cast<unsigned int>(m_BP4Serializer.m_SizeMPI))
     {
-        m_BP4Serializer.m_Aggregator.Init(
+        m_BP4Serializer.m_Aggregator->Init(
             m_BP4Serializer.m_Parameters.NumAggregators, m_Comm);
     }
     InitTransports();
@@ -164,6 +181,13 @@ void BP4Writer::InitParameters()
     m_BP4Serializer.Init(m_IO.m_Parameters, "in call to BP4::Open to write");
     m_WriteToBB = !(m_BP4Serializer.m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_BP4Serializer.m_Parameters.BurstBufferDrain;
+
+    if (m_BP4Serializer.m_Parameters.AsyncWrite)
+    {
+        m_AsyncDataChunks.reset(new format::BufferChunked(
+            m_BP4Serializer.m_Parameters.BufferChunkSize,
+            m_BP4Serializer.m_Parameters.BufferChunkHugePages));
+    }
 }
 
 void BP4Writer::InitTransports()
@@ -176,6 +200,38 @@ void BP4Writer::InitTransports()
         m_IO.m_TransportsParameters.push_back(defaultTransportParameters);
     }
 
+    // metadata files are never striped, readers open them with any library
+    std::vector<Params> metadataTransportsParameters =
+        m_IO.m_TransportsParameters;
+    for (Params &parameters : metadataTransportsParameters)
+    {
+        std::string directIO("false");
+        helper::SetParameterValue("DirectIO", parameters, directIO);
+        helper::SetParameterValue("directio", parameters, directIO);
+        if (helper::LowerCase(directIO) == "true")
+        {
+            m_DataAlignment = DefaultDirectIOAlignment;
+        }
+
+        std::string library;
+        helper::SetParameterValue("Library", parameters, library);
+        helper::SetParameterValue("library", parameters, library);
+        if (helper::LowerCase(library) == "stripe" ||
+            helper::LowerCase(library) == "striped")
+        {
+            if (m_DrainBB)
+            {
+                throw std::invalid_argument(
+                    "ERROR: the striped file transport can't be used with "
+                    "BurstBufferDrain, in call to Open " +
+                    m_Name + "\n");
+            }
+            m_BP4Serializer.m_StripedData = true;
+            parameters.erase("library");
+            parameters["Library"] = DefaultFileLibrary;
+        }
+    }
+
     // only consumers will interact with transport managers
     m_BBName = m_Name;
     if (m_WriteToBB)
@@ -184,7 +240,7 @@ void BP4Writer::InitTransports()
                    PathSeparator + m_Name;
     }
 
-    if (m_BP4Serializer.m_Aggregator.m_IsConsumer)
+    if (m_BP4Serializer.m_Aggregator->m_IsConsumer)
     {
         // Names passed to IO AddTransport option with key "Name"
         const std::vector<std::string> transportsNames =
@@ -200,11 +256,25 @@ void BP4Writer::InitTransports()
                     m_Name, m_IO.m_TransportsParameters);
             m_DrainSubStreamNames =
                 m_BP4Serializer.GetBPSubStreamNames(drainTransportNames);
-            /* start up BB thread */
-            m_FileDrainer.SetVerbose(
+            // a drain detached at Close may still write to the same target
+            burstbuffer::FileDrainer::JoinDetached();
+            /* start up BB thread(s) */
+            if (m_BP4Serializer.m_Parameters.BurstBufferDrainThreads > 1)
+            {
+                m_FileDrainer.reset(new burstbuffer::FileDrainerMultiThread(
+                    m_BP4Serializer.m_Parameters.BurstBufferDrainThreads));
+            }
+            else
+            {
+                m_FileDrainer.reset(
+                    new burstbuffer::FileDrainerSingleThread());
+            }
+            m_FileDrainer->SetVerbose(
                 m_BP4Serializer.m_Parameters.BurstBufferVerbose,
                 m_BP4Serializer.m_RankMPI);
-            m_FileDrainer.Start();
+            m_FileDrainer->SetMaxBandwidth(
+                m_BP4Serializer.m_Parameters.BurstBufferDrainMaxBandwidth);
+            m_FileDrainer->Start();
         }
     }
 
@@ -222,7 +292,7 @@ void BP4Writer::InitTransports()
     }
     m_BP4Serializer.m_Profiler.Stop("mkdir");
 
-    if (m_BP4Serializer.m_Aggregator.m_IsConsumer)
+    if (m_BP4Serializer.m_Aggregator->m_IsConsumer)
     {
         if (m_BP4Serializer.m_Parameters.AsyncTasks)
         {
@@ -240,7 +310,7 @@ void BP4Writer::InitTransports()
         {
             for (const auto &name : m_DrainSubStreamNames)
             {
-                m_FileDrainer.AddOperationOpen(name, m_OpenMode);
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
             }
         }
     }
@@ -255,14 +325,14 @@ void BP4Writer::InitTransports()
             m_BP4Serializer.GetBPMetadataFileNames(transportsNames);
 
         m_FileMetadataManager.OpenFiles(m_MetadataFileNames, m_OpenMode,
-                                        m_IO.m_TransportsParameters,
+                                        metadataTransportsParameters,
                                         m_BP4Serializer.m_Profiler.m_IsActive);
 
         m_MetadataIndexFileNames =
             m_BP4Serializer.GetBPMetadataIndexFileNames(transportsNames);
 
         m_FileMetadataIndexManager.OpenFiles(
-            m_MetadataIndexFileNames, m_OpenMode, m_IO.m_TransportsParameters,
+            m_MetadataIndexFileNames, m_OpenMode, metadataTransportsParameters,
             m_BP4Serializer.m_Profiler.m_IsActive);
 
         if (m_DrainBB)
@@ -278,11 +348,11 @@ void BP4Writer::InitTransports()
 
             for (const auto &name : m_DrainMetadataFileNames)
             {
-                m_FileDrainer.AddOperationOpen(name, m_OpenMode);
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
             }
             for (const auto &name : m_DrainMetadataIndexFileNames)
             {
-                m_FileDrainer.AddOperationOpen(name, m_OpenMode);
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
             }
         }
     }
@@ -333,7 +403,7 @@ void BP4Writer::InitBPBuffer()
                 static_cast<uint32_t>(lastStep);
             m_BP4Serializer.m_MetadataSet.CurrentStep += lastStep;
 
-            if (m_BP4Serializer.m_Aggregator.m_IsConsumer)
+            if (m_BP4Serializer.m_Aggregator->m_IsConsumer)
             {
                 m_BP4Serializer.m_PreDataFileLength =
                     m_FileDataManager.GetFileSize(0);
@@ -361,7 +431,7 @@ void BP4Writer::InitBPBuffer()
             m_BP4Serializer.MakeHeader(m_BP4Serializer.m_MetadataIndex,
                                        "Index Table", true);
         }
-        if (m_BP4Serializer.m_Aggregator.m_IsConsumer)
+        if (m_BP4Serializer.m_Aggregator->m_IsConsumer)
         {
             m_BP4Serializer.MakeHeader(m_BP4Serializer.m_Data, "Data", false);
         }
@@ -381,15 +451,42 @@ void BP4Writer::InitBPBuffer()
         m_FileDataManager.GetTransportsTypes());
 }
 
-void BP4Writer::DoFlush(const bool isFinal, const int transportIndex)
+void BP4Writer::DoFlush(const bool isFinal, const int transportIndex,
+                        const bool asyncWrite)
 {
-    if (m_BP4Serializer.m_Aggregator.m_IsActive)
+    if (m_BP4Serializer.m_Aggregator->m_IsActive)
     {
-        AggregateWriteData(isFinal, transportIndex);
+        AggregateWriteData(isFinal, transportIndex, asyncWrite);
     }
     else
     {
-        WriteData(isFinal, transportIndex);
+        WriteData(isFinal, transportIndex, asyncWrite);
+    }
+}
+
+void BP4Writer::FlushCommon(const bool asyncWrite, const int transportIndex)
+{
+    DoFlush(false, transportIndex, asyncWrite);
+    m_BP4Serializer.ResetBuffer(m_BP4Serializer.m_Data);
+
+    if (m_BP4Serializer.m_Parameters.CollectiveMetadata)
+    {
+        WriteCollectiveMetadataFile(false, asyncWrite);
+    }
+
+    if (m_FileDrainer)
+    {
+        // an asynchronous flush adds the drain of the previous one
+        size_t steps = CurrentStep();
+        if (asyncWrite)
+        {
+            std::swap(steps, m_AsyncDrainSteps);
+        }
+        else
+        {
+            m_AsyncDrainSteps = steps;
+        }
+        m_FileDrainer->AddOperationStepsDone(steps);
     }
 }
 
@@ -398,12 +495,13 @@ void BP4Writer::DoClose(const int transportIndex)
     TAU_SCOPED_TIMER("BP4Writer::Close");
     if (m_BP4Serializer.m_DeferredVariables.size() > 0)
     {
-        PerformPuts();
+        // data is written right after
+        PerformPutsCommon(true);
     }
 
     DoFlush(true, transportIndex);
 
-    if (m_BP4Serializer.m_Aggregator.m_IsConsumer)
+    if (m_BP4Serializer.m_Aggregator->m_IsConsumer)
     {
         m_FileDataManager.CloseFiles(transportIndex);
         // Delete files from temporary storage if draining was on
@@ -411,7 +509,7 @@ void BP4Writer::DoClose(const int transportIndex)
         {
             for (const auto &name : m_SubStreamNames)
             {
-                m_FileDrainer.AddOperationDelete(name);
+                m_FileDrainer->AddOperationDelete(name);
             }
         }
     }
@@ -428,9 +526,9 @@ void BP4Writer::DoClose(const int transportIndex)
         // std::cout << "write profiling file!" << std::endl;
         WriteProfilingJSONFile();
     }
-    if (m_BP4Serializer.m_Aggregator.m_IsActive)
+    if (m_BP4Serializer.m_Aggregator->m_IsActive)
     {
-        m_BP4Serializer.m_Aggregator.Close();
+        m_BP4Serializer.m_Aggregator->Close();
     }
 
     if (m_BP4Serializer.m_RankMPI == 0)
@@ -449,26 +547,34 @@ void BP4Writer::DoClose(const int transportIndex)
         {
             for (const auto &name : m_MetadataFileNames)
             {
-                m_FileDrainer.AddOperationDelete(name);
+                m_FileDrainer->AddOperationDelete(name);
             }
             for (const auto &name : m_MetadataIndexFileNames)
             {
-                m_FileDrainer.AddOperationDelete(name);
+                m_FileDrainer->AddOperationDelete(name);
             }
             const std::vector<std::string> transportsNames =
                 m_FileDataManager.GetFilesBaseNames(
                     m_BBName, m_IO.m_TransportsParameters);
             for (const auto &name : transportsNames)
             {
-                m_FileDrainer.AddOperationDelete(name);
+                m_FileDrainer->AddOperationDelete(name);
             }
         }
     }
 
-    if (m_BP4Serializer.m_Aggregator.m_IsConsumer && m_DrainBB)
+    if (m_BP4Serializer.m_Aggregator->m_IsConsumer && m_DrainBB)
     {
+        m_FileDrainer->AddOperationStepsDone(
+            std::max<size_t>(CurrentStep(), 1));
         /* Signal the BB thread that no more work is coming */
-        m_FileDrainer.Finish();
+        m_FileDrainer->Finish();
+        if (!m_BP4Serializer.m_Parameters.BurstBufferWaitForDrain &&
+            !m_FileDrainer->IsDone())
+        {
+            // the drain continues in the background after the engine is gone
+            burstbuffer::FileDrainer::Detach(std::move(m_FileDrainer));
+        }
     }
     // m_BP4Serializer.DeleteBuffers();
 }
@@ -523,7 +629,7 @@ void BP4Writer::WriteProfilingJSONFile()
             {
                 profileFileName = bpTargetNames[0] + "_profiling.json";
             }
-            m_FileDrainer.AddOperationWrite(
+            m_FileDrainer->AddOperationWrite(
                 profileFileName, profilingJSON.size(), profilingJSON.data());
         }
         else
@@ -578,15 +684,17 @@ void BP4Writer::UpdateActiveFlag(const bool active)
     {
         for (size_t i = 0; i < m_MetadataIndexFileNames.size(); ++i)
         {
-            m_FileDrainer.AddOperationWriteAt(
+            m_FileDrainer->AddOperationWriteAt(
                 m_DrainMetadataIndexFileNames[i],
                 m_BP4Serializer.m_ActiveFlagPosition, 1, &activeChar);
-            m_FileDrainer.AddOperationSeekEnd(m_DrainMetadataIndexFileNames[i]);
+            m_FileDrainer->AddOperationSeekEnd(
+                m_DrainMetadataIndexFileNames[i]);
         }
     }
 }
 
-void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
+void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal,
+                                            const bool asyncWrite)
 {
 
     TAU_SCOPED_TIMER("BP4Writer::WriteCollectiveMetadataFile");
@@ -595,6 +703,15 @@ void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
     {
         // If data pg count is zero, it means all metadata
         // has already been written, don't need to write it again.
+        if (m_BP4Serializer.m_Parameters.AsyncWrite)
+        {
+            // all ranks must have finished their data writes
+            m_Comm.Barrier();
+            if (m_BP4Serializer.m_RankMPI == 0)
+            {
+                WriteAsyncMetadataFiles();
+            }
+        }
         return;
     }
     m_BP4Serializer.AggregateCollectiveMetadata(
@@ -602,20 +719,11 @@ void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
 
     if (m_BP4Serializer.m_RankMPI == 0)
     {
-
-        m_FileMetadataManager.WriteFiles(
-            m_BP4Serializer.m_Metadata.m_Buffer.data(),
-            m_BP4Serializer.m_Metadata.m_Position);
-        m_FileMetadataManager.FlushFiles();
-
-        if (m_DrainBB)
+        if (m_BP4Serializer.m_Parameters.AsyncWrite)
         {
-            for (size_t i = 0; i < m_MetadataFileNames.size(); ++i)
-            {
-                m_FileDrainer.AddOperationCopy(
-                    m_MetadataFileNames[i], m_DrainMetadataFileNames[i],
-                    m_BP4Serializer.m_Metadata.m_Position);
-            }
+            // all ranks waited for their previous data write before
+            // aggregating, now the previous metadata can be published
+            WriteAsyncMetadataFiles();
         }
 
         std::time_t currentTimeStamp = std::time(nullptr);
@@ -663,24 +771,28 @@ void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
                 currentTimeStamp);
         }
 
-        m_FileMetadataIndexManager.WriteFiles(
-            m_BP4Serializer.m_MetadataIndex.m_Buffer.data(),
-            m_BP4Serializer.m_MetadataIndex.m_Position);
-        m_FileMetadataIndexManager.FlushFiles();
+        if (asyncWrite)
+        {
+            // data of this flush may still be in flight, hold the metadata
+            // back until the next flush
+            m_AsyncMetadata.assign(m_BP4Serializer.m_Metadata.m_Buffer.begin(),
+                                   m_BP4Serializer.m_Metadata.m_Buffer.begin() +
+                                       m_BP4Serializer.m_Metadata.m_Position);
+            m_AsyncMetadataIndex.assign(
+                m_BP4Serializer.m_MetadataIndex.m_Buffer.begin(),
+                m_BP4Serializer.m_MetadataIndex.m_Buffer.begin() +
+                    m_BP4Serializer.m_MetadataIndex.m_Position);
+        }
+        else
+        {
+            WriteMetadataFiles(m_BP4Serializer.m_Metadata.m_Buffer,
+                               m_BP4Serializer.m_Metadata.m_Position,
+                               m_BP4Serializer.m_MetadataIndex.m_Buffer,
+                               m_BP4Serializer.m_MetadataIndex.m_Position);
+        }
 
         m_BP4Serializer.m_MetadataSet.MetadataFileLength +=
             m_BP4Serializer.m_Metadata.m_Position;
-
-        if (m_DrainBB)
-        {
-            for (size_t i = 0; i < m_MetadataIndexFileNames.size(); ++i)
-            {
-                m_FileDrainer.AddOperationWrite(
-                    m_DrainMetadataIndexFileNames[i],
-                    m_BP4Serializer.m_MetadataIndex.m_Position,
-                    m_BP4Serializer.m_MetadataIndex.m_Buffer.data());
-            }
-        }
     }
     /*Clear the local indices buffer at the end of each step*/
     m_BP4Serializer.ResetBuffer(m_BP4Serializer.m_Metadata, true);
@@ -693,7 +805,8 @@ void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
     m_BP4Serializer.ResetAllIndices();
 }
 
-void BP4Writer::WriteData(const bool isFinal, const int transportIndex)
+void BP4Writer::WriteData(const bool isFinal, const int transportIndex,
+                          const bool asyncWrite)
 {
     TAU_SCOPED_TIMER("BP4Writer::WriteData");
     size_t dataSize;
@@ -708,65 +821,153 @@ void BP4Writer::WriteData(const bool isFinal, const int transportIndex)
         dataSize = m_BP4Serializer.CloseStream(m_IO, false);
     }
 
-    m_FileDataManager.WriteFiles(m_BP4Serializer.m_Data.m_Buffer.data(),
-                                 dataSize, transportIndex);
+    if (m_DataAlignment > 1)
+    {
+        dataSize = m_BP4Serializer.PadData(m_DataAlignment);
+    }
 
-    m_FileDataManager.FlushFiles(transportIndex);
-    if (m_DrainBB)
+    if (!m_BP4Serializer.m_ZeroCopyPayloads.empty())
     {
-        for (size_t i = 0; i < m_SubStreamNames.size(); ++i)
+        const size_t fileSize = WriteZeroCopyData(dataSize, transportIndex);
+        if (m_DrainBB)
+        {
+            for (size_t i = 0; i < m_SubStreamNames.size(); ++i)
+            {
+                m_FileDrainer->AddOperationCopy(
+                    m_SubStreamNames[i], m_DrainSubStreamNames[i], fileSize);
+            }
+        }
+        return;
+    }
+
+    if (m_BP4Serializer.m_Parameters.AsyncWrite)
+    {
+        // blocks while the previous buffer is still being written
+        WaitAsyncWriteData();
+
+        if (asyncWrite &&
+            dataSize <= m_BP4Serializer.m_Parameters.AsyncWriteMaxBufferSize)
         {
-            m_FileDrainer.AddOperationCopy(m_SubStreamNames[i],
-                                           m_DrainSubStreamNames[i], dataSize);
+            // m_Data continues with the buffer of the previous write
+            std::vector<char> &buffer = m_BP4Serializer.m_Data.m_Buffer;
+            m_AsyncDataBuffer.resize(buffer.size());
+            m_AsyncDataBuffer.swap(buffer);
+            AsyncWriteData(dataSize, transportIndex);
+            return;
         }
     }
+
+    WriteDataFiles(m_BP4Serializer.m_Data.m_Buffer.data(), dataSize,
+                   transportIndex);
 }
 
-void BP4Writer::AggregateWriteData(const bool isFinal, const int transportIndex)
+void BP4Writer::AggregateWriteData(const bool isFinal, const int transportIndex,
+                                   const bool asyncWrite)
 {
     TAU_SCOPED_TIMER("BP4Writer::AggregateWriteData");
     m_BP4Serializer.CloseStream(m_IO, false);
+    if (m_DataAlignment > 1)
+    {
+        m_BP4Serializer.PadData(m_DataAlignment);
+    }
     size_t totalBytesWritten = 0;
 
-    // async?
-    for (int r = 0; r < m_BP4Serializer.m_Aggregator.m_Size; ++r)
+    // bytes of this rank, used to balance substreams
+    const size_t flushBytes = m_BP4Serializer.m_Data.m_Position +
+                              m_BP4Serializer.GetZeroCopyPayloadsSize(0);
+
+    // consumer collects the aggregated data to write it in the background
+    bool collectData = asyncWrite;
+    if (m_BP4Serializer.m_Parameters.AsyncWrite)
+    {
+        // blocks while the previous buffer is still being written
+        WaitAsyncWriteData();
+        m_AsyncDataChunks->Reset(true, false);
+    }
+
+    for (int r = 0; r < m_BP4Serializer.m_Aggregator->m_Size; ++r)
     {
         aggregator::MPIAggregator::ExchangeRequests dataRequests =
-            m_BP4Serializer.m_Aggregator.IExchange(m_BP4Serializer.m_Data, r);
+            m_BP4Serializer.m_Aggregator->IExchange(m_BP4Serializer.m_Data, r);
 
         aggregator::MPIAggregator::ExchangeAbsolutePositionRequests
             absolutePositionRequests =
-                m_BP4Serializer.m_Aggregator.IExchangeAbsolutePosition(
+                m_BP4Serializer.m_Aggregator->IExchangeAbsolutePosition(
                     m_BP4Serializer.m_Data, r);
 
-        if (m_BP4Serializer.m_Aggregator.m_IsConsumer)
+        if (m_BP4Serializer.m_Aggregator->m_IsConsumer)
         {
             const format::Buffer &bufferSTL =
-                m_BP4Serializer.m_Aggregator.GetConsumerBuffer(
+                m_BP4Serializer.m_Aggregator->GetConsumerBuffer(
                     m_BP4Serializer.m_Data);
-            if (bufferSTL.m_Position > 0)
+            if (bufferSTL.m_Position > 0 &&
+                &bufferSTL == &m_BP4Serializer.m_Data &&
+                !m_BP4Serializer.m_ZeroCopyPayloads.empty())
             {
-                m_FileDataManager.WriteFiles(
-                    bufferSTL.Data(), bufferSTL.m_Position, transportIndex);
-
-                m_FileDataManager.FlushFiles(transportIndex);
+                // own data interleaved with payloads from user memory
+                totalBytesWritten +=
+                    WriteZeroCopyData(bufferSTL.m_Position, transportIndex);
+            }
+            else if (bufferSTL.m_Position > 0)
+            {
+                if (collectData &&
+                    m_AsyncDataChunks->m_Position + bufferSTL.m_Position >
+                        m_BP4Serializer.m_Parameters.AsyncWriteMaxBufferSize)
+                {
+                    // over the limit, write collected data and continue
+                    // synchronously
+                    WriteDataChunks(transportIndex);
+                    collectData = false;
+                }
+
+                if (collectData)
+                {
+                    m_AsyncDataChunks->Append(bufferSTL.Data(),
+                                              bufferSTL.m_Position);
+                }
+                else
+                {
+                    m_FileDataManager.WriteFiles(
+                        bufferSTL.Data(), bufferSTL.m_Position, transportIndex);
+
+                    m_FileDataManager.FlushFiles(transportIndex);
+                }
 
                 totalBytesWritten += bufferSTL.m_Position;
             }
         }
 
-        m_BP4Serializer.m_Aggregator.WaitAbsolutePosition(
+        m_BP4Serializer.m_Aggregator->WaitAbsolutePosition(
             absolutePositionRequests, r);
 
-        m_BP4Serializer.m_Aggregator.Wait(dataRequests, r);
-        m_BP4Serializer.m_Aggregator.SwapBuffers(r);
+        m_BP4Serializer.m_Aggregator->Wait(dataRequests, r);
+        m_BP4Serializer.m_Aggregator->SwapBuffers(r);
     }
 
-    if (m_DrainBB)
+    if (collectData && m_BP4Serializer.m_Aggregator->m_IsConsumer)
+    {
+        if (m_FileDataManager.AsyncFiles(transportIndex) && !m_DrainBB)
+        {
+            // all chunks in flight at once, no background thread needed
+            for (const auto &chunk : m_AsyncDataChunks->GetChunks())
+            {
+                m_FileDataManager.IWriteFiles(chunk.Data, chunk.Size,
+                                              transportIndex);
+            }
+        }
+        else
+        {
+            // drain operations are added after the background write
+            m_AsyncWriteFuture =
+                std::async(std::launch::async, &BP4Writer::WriteDataChunks,
+                           this, transportIndex);
+        }
+    }
+    else if (m_DrainBB)
     {
         for (size_t i = 0; i < m_SubStreamNames.size(); ++i)
         {
-            m_FileDrainer.AddOperationCopy(m_SubStreamNames[i],
+            m_FileDrainer->AddOperationCopy(m_SubStreamNames[i],
                                            m_DrainSubStreamNames[i],
                                            totalBytesWritten);
         }
@@ -776,10 +977,17 @@ void BP4Writer::AggregateWriteData(const bool isFinal, const int transportIndex)
 
     if (isFinal) // Write metadata footer
     {
-        m_BP4Serializer.m_Aggregator.Close();
+        m_BP4Serializer.m_Aggregator->Close();
     }
 
-    m_BP4Serializer.m_Aggregator.ResetBuffers();
+    m_BP4Serializer.m_Aggregator->ResetBuffers();
+
+    if (!isFinal)
+    {
+        // producers may write to another substream from the next step, the
+        // file index of a block is set at Put
+        m_BP4Serializer.m_Aggregator->Rebalance(flushBytes, m_Comm);
+    }
 }
 
 #define declare_type(T, L)                                                     \
@@ -792,6 +1000,154 @@ void BP4Writer::AggregateWriteData(const bool isFinal, const int transportIndex)
 ADIOS2_FOREACH_PRIMITVE_STDTYPE_2ARGS(declare_type)
 #undef declare_type
 
+void BP4Writer::WriteMetadataFiles(const std::vector<char> &metadata,
+                                   const size_t metadataSize,
+                                   const std::vector<char> &metadataIndex,
+                                   const size_t metadataIndexSize)
+{
+    TAU_SCOPED_TIMER("BP4Writer::WriteMetadataFiles");
+    m_FileMetadataManager.WriteFiles(metadata.data(), metadataSize);
+    m_FileMetadataManager.FlushFiles();
+
+    if (m_DrainBB)
+    {
+        for (size_t i = 0; i < m_MetadataFileNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationCopy(m_MetadataFileNames[i],
+                                           m_DrainMetadataFileNames[i],
+                                           metadataSize);
+        }
+    }
+
+    m_FileMetadataIndexManager.WriteFiles(metadataIndex.data(),
+                                          metadataIndexSize);
+    m_FileMetadataIndexManager.FlushFiles();
+
+    if (m_DrainBB)
+    {
+        for (size_t i = 0; i < m_MetadataIndexFileNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationWrite(m_DrainMetadataIndexFileNames[i],
+                                            metadataIndexSize,
+                                            metadataIndex.data());
+        }
+    }
+}
+
+void BP4Writer::WriteAsyncMetadataFiles()
+{
+    if (m_AsyncMetadataIndex.empty())
+    {
+        return;
+    }
+
+    WriteMetadataFiles(m_AsyncMetadata, m_AsyncMetadata.size(),
+                       m_AsyncMetadataIndex, m_AsyncMetadataIndex.size());
+    m_AsyncMetadata.clear();
+    m_AsyncMetadataIndex.clear();
+}
+
+void BP4Writer::WriteDataFiles(const char *buffer, const size_t size,
+                               const int transportIndex)
+{
+    TAU_SCOPED_TIMER("BP4Writer::WriteDataFiles");
+    m_FileDataManager.WriteFiles(buffer, size, transportIndex);
+    m_FileDataManager.FlushFiles(transportIndex);
+
+    if (m_DrainBB)
+    {
+        for (size_t i = 0; i < m_SubStreamNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationCopy(m_SubStreamNames[i],
+                                           m_DrainSubStreamNames[i], size);
+        }
+    }
+}
+
+size_t BP4Writer::WriteZeroCopyData(const size_t dataSize,
+                                    const int transportIndex)
+{
+    TAU_SCOPED_TIMER("BP4Writer::WriteZeroCopyData");
+    const std::vector<char> &buffer = m_BP4Serializer.m_Data.m_Buffer;
+    std::vector<format::BP4Serializer::ZeroCopyPayload> &payloads =
+        m_BP4Serializer.m_ZeroCopyPayloads;
+
+    // data buffer segments interleaved with the payloads, same layout as if
+    // the payloads had been copied into the buffer
+    std::vector<Transport::IOVec> iov;
+    iov.reserve(2 * payloads.size() + 1);
+    size_t position = 0;
+    size_t fileSize = dataSize;
+    for (const auto &payload : payloads)
+    {
+        iov.push_back(
+            {buffer.data() + position, payload.BufferPosition - position});
+        iov.push_back({payload.Data, payload.Size});
+        position = payload.BufferPosition;
+        fileSize += payload.Size;
+    }
+    iov.push_back({buffer.data() + position, dataSize - position});
+
+    m_FileDataManager.WriteFiles(iov, transportIndex);
+    m_FileDataManager.FlushFiles(transportIndex);
+
+    payloads.clear();
+    return fileSize;
+}
+
+void BP4Writer::AsyncWriteData(const size_t size, const int transportIndex)
+{
+    if (m_FileDataManager.AsyncFiles(transportIndex) && !m_DrainBB)
+    {
+        // the transport writes in the background, with a drainer the thread
+        // is kept so that the copy is added after the write is done
+        m_FileDataManager.IWriteFiles(m_AsyncDataBuffer.data(), size,
+                                      transportIndex);
+        return;
+    }
+
+    m_AsyncWriteFuture =
+        std::async(std::launch::async, &BP4Writer::WriteDataFiles, this,
+                   m_AsyncDataBuffer.data(), size, transportIndex);
+}
+
+void BP4Writer::WriteDataChunks(const int transportIndex)
+{
+    TAU_SCOPED_TIMER("BP4Writer::WriteDataChunks");
+    const std::vector<format::BufferChunked::Chunk> chunks =
+        m_AsyncDataChunks->GetChunks();
+
+    std::vector<Transport::IOVec> iov;
+    iov.reserve(chunks.size());
+    for (const auto &chunk : chunks)
+    {
+        iov.push_back({chunk.Data, chunk.Size});
+    }
+
+    m_FileDataManager.WriteFiles(iov, transportIndex);
+    m_FileDataManager.FlushFiles(transportIndex);
+
+    if (m_DrainBB)
+    {
+        for (size_t i = 0; i < m_SubStreamNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationCopy(m_SubStreamNames[i],
+                                           m_DrainSubStreamNames[i],
+                                           m_AsyncDataChunks->m_Position);
+        }
+    }
+}
+
+void BP4Writer::WaitAsyncWriteData()
+{
+    if (m_AsyncWriteFuture.valid())
+    {
+        // rethrows exceptions from the background write
+        m_AsyncWriteFuture.get();
+    }
+    m_FileDataManager.WaitFiles();
+}
+
 size_t BP4Writer::DebugGetDataBufferSize() const
 {
     return m_BP4Serializer.DebugGetDataBufferSize();
@@ -14,10 +14,15 @@
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/core/Engine.h"
 #include "adios2/helper/adiosComm.h"
+#include "adios2/toolkit/burstbuffer/FileDrainerMultiThread.h"
 #include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
 #include "adios2/toolkit/format/bp/bp4/BP4Serializer.h"
+#include "adios2/toolkit/format/buffer/heap/BufferChunked.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
+#include <future>
+#include <memory>
+
 namespace adios2
 {
 namespace core
@@ -43,6 +48,7 @@ public:
     StepStatus BeginStep(StepMode mode,
                          const float timeoutSeconds = -1.0) final;
     size_t CurrentStep() const final;
+    size_t DrainedSteps() const final;
     void PerformPuts() final;
     void EndStep() final;
     void Flush(const int transportIndex = -1) final;
@@ -69,8 +75,11 @@ private:
     bool m_WriteToBB = false;
     /** true if burst buffer is drained to disk  */
     bool m_DrainBB = true;
-    /** File drainer thread if burst buffer is used */
-    burstbuffer::FileDrainerSingleThread m_FileDrainer;
+    /** File drainer thread(s) if burst buffer is used, created at Open */
+    std::unique_ptr<burstbuffer::FileDrainer> m_FileDrainer;
+    /** AsyncWrite: steps of the previous flush, its drain operations are
+     * all added at the next flush */
+    size_t m_AsyncDrainSteps = 0;
     /** m_Name modified with burst buffer path if BB is used,
      * == m_Name otherwise.
      * m_Name is a constant of Engine and is the user provided target path
@@ -88,6 +97,24 @@ private:
     std::vector<std::string> m_DrainMetadataIndexFileNames;
     std::vector<std::string> m_ActiveFlagFileNames;
 
+    /*
+     *  Asynchronous write variables, used with the AsyncWrite parameter
+     */
+    /** data being written in the background, swapped with m_Data */
+    std::vector<char> m_AsyncDataBuffer;
+    /** aggregator consumer: data collected from its ranks, written in the
+     * background, grows by chunks without copying what was collected */
+    std::unique_ptr<format::BufferChunked> m_AsyncDataChunks;
+    /** background write of m_AsyncDataBuffer or m_AsyncDataChunks */
+    std::future<void> m_AsyncWriteFuture;
+    /** DirectIO transports: every flush of a rank is padded to this many
+     * bytes so that direct writes stay aligned, 1: no padding */
+    size_t m_DataAlignment = 1;
+    /** rank 0: metadata and index table of the last flush, written when all
+     * ranks have finished writing its data in the background */
+    std::vector<char> m_AsyncMetadata;
+    std::vector<char> m_AsyncMetadataIndex;
+
     void Init() final;
 
     /** Parses parameters from IO SetParameters */
@@ -118,12 +145,28 @@ private:
     template <class T>
     void PutSyncCommon(Variable<T> &variable,
                        const typename Variable<T>::Info &blockInfo,
-                       const bool resize = true);
+                       const bool resize = true, const bool zeroCopy = false);
 
     template <class T>
     void PutDeferredCommon(Variable<T> &variable, const T *data);
 
-    void DoFlush(const bool isFinal = false, const int transportIndex = -1);
+    /**
+     * Writes the data buffer
+     * @param isFinal true: called from Close
+     * @param transportIndex
+     * @param asyncWrite true: data can be written in the background
+     */
+    void DoFlush(const bool isFinal = false, const int transportIndex = -1,
+                 const bool asyncWrite = false);
+
+    /**
+     * Writes the data buffer and the collective metadata, common to Flush and
+     * EndStep
+     * @param asyncWrite true: data can be written in the background and
+     * metadata is held back until the next flush
+     * @param transportIndex
+     */
+    void FlushCommon(const bool asyncWrite, const int transportIndex = -1);
 
     void DoClose(const int transportIndex = -1) final;
 
@@ -139,19 +182,70 @@ private:
 
     void UpdateActiveFlag(const bool active);
 
-    void WriteCollectiveMetadataFile(const bool isFinal = false);
+    void WriteCollectiveMetadataFile(const bool isFinal = false,
+                                     const bool asyncWrite = false);
 
     /**
      * N-to-N data buffers writes, including metadata file
      * @param transportIndex
      */
-    void WriteData(const bool isFinal, const int transportIndex = -1);
+    void WriteData(const bool isFinal, const int transportIndex = -1,
+                   const bool asyncWrite = false);
 
     /**
      * N-to-M (aggregation) data buffers writes, including metadata file
      * @param transportIndex
      */
-    void AggregateWriteData(const bool isFinal, const int transportIndex = -1);
+    void AggregateWriteData(const bool isFinal, const int transportIndex = -1,
+                            const bool asyncWrite = false);
+
+    /**
+     * Writes data to the data files, called in the background with
+     * AsyncWrite
+     * @param data
+     * @param size
+     * @param transportIndex
+     */
+    void WriteDataFiles(const char *data, const size_t size,
+                        const int transportIndex);
+
+    /**
+     * Gathered write of the data buffer and the payloads in
+     * m_BP4Serializer.m_ZeroCopyPayloads directly from user memory
+     * @param dataSize bytes to write from the data buffer
+     * @param transportIndex
+     * @return bytes written to the data files
+     */
+    size_t WriteZeroCopyData(const size_t dataSize, const int transportIndex);
+
+    /**
+     * Starts writing m_AsyncDataBuffer in the background, without a thread
+     * if the data transports implement asynchronous I/O (Library=AIO)
+     * @param size bytes to write from m_AsyncDataBuffer
+     * @param transportIndex
+     */
+    void AsyncWriteData(const size_t size, const int transportIndex);
+
+    /**
+     * Gathered write of the chunks in m_AsyncDataChunks
+     * @param transportIndex
+     */
+    void WriteDataChunks(const int transportIndex);
+
+    /** Blocks until the background write of the previous flush is done */
+    void WaitAsyncWriteData();
+
+    /**
+     * Rank 0 writes metadata and metadata index table contents to md.0 and
+     * md.idx
+     */
+    void WriteMetadataFiles(const std::vector<char> &metadata,
+                            const size_t metadataSize,
+                            const std::vector<char> &metadataIndex,
+                            const size_t metadataIndexSize);
+
+    /** Rank 0 writes the metadata held back from the previous flush */
+    void WriteAsyncMetadataFiles();
 
 #define declare_type(T, L)                                                     \
     T *DoBufferData_##L(const size_t payloadPosition,                          \
@@ -164,8 +258,16 @@ private:
     T *BufferDataCommon(const size_t payloadOffset,
                         const size_t bufferID) noexcept;
 
+    /**
+     * Serializes deferred Puts
+     * @param zeroCopy true: the data buffer is written before the user
+     * memory can be reused (EndStep with flush, Close), payloads above
+     * ZeroCopyThreshold are not copied
+     */
+    void PerformPutsCommon(const bool zeroCopy);
+
     template <class T>
-    void PerformPutCommon(Variable<T> &variable);
+    void PerformPutCommon(Variable<T> &variable, const bool zeroCopy);
 };
 
 } // end namespace engine
@@ -64,7 +64,7 @@ void BP4Writer::PutCommon(Variable<T> &variable,
 template <class T>
 void BP4Writer::PutSyncCommon(Variable<T> &variable,
                               const typename Variable<T>::Info &blockInfo,
-                              const bool resize)
+                              const bool resize, const bool zeroCopy)
 {
     format::BP4Base::ResizeResult resizeResult =
         format::BP4Base::ResizeResult::Success;
@@ -100,7 +100,8 @@ void BP4Writer::PutSyncCommon(Variable<T> &variable,
     // WRITE INDEX to data buffer and metadata structure (in memory)//
     const bool sourceRowMajor = helper::IsRowMajor(m_IO.m_HostLanguage);
     m_BP4Serializer.PutVariableMetadata(variable, blockInfo, sourceRowMajor);
-    m_BP4Serializer.PutVariablePayload(variable, blockInfo, sourceRowMajor);
+    m_BP4Serializer.PutVariablePayload(variable, blockInfo, sourceRowMajor,
+                                       nullptr, zeroCopy);
 }
 
 template <class T>
@@ -115,10 +116,22 @@ void BP4Writer::PutDeferredCommon(Variable<T> &variable, const T *data)
     const typename Variable<T>::Info blockInfo =
         variable.SetBlockInfo(data, CurrentStep());
     m_BP4Serializer.m_DeferredVariables.insert(variable.m_Name);
-    m_BP4Serializer.m_DeferredVariablesDataSize += static_cast<size_t>(
-        1.05 * helper::PayloadSize(blockInfo.Data, blockInfo.Count) +
-        4 * m_BP4Serializer.GetBPIndexSizeInData(variable.m_Name,
-                                                 blockInfo.Count));
+
+    const size_t payloadSize =
+        helper::PayloadSize(blockInfo.Data, blockInfo.Count);
+    const size_t indexSize = 4 * m_BP4Serializer.GetBPIndexSizeInData(
+                                     variable.m_Name, blockInfo.Count);
+
+    if (m_BP4Serializer.IsZeroCopyPayload(variable, blockInfo))
+    {
+        m_BP4Serializer.m_DeferredZeroCopyDataSize += payloadSize;
+        m_BP4Serializer.m_DeferredVariablesDataSize += indexSize;
+    }
+    else
+    {
+        m_BP4Serializer.m_DeferredVariablesDataSize +=
+            static_cast<size_t>(1.05 * payloadSize + indexSize);
+    }
 }
 
 template <class T>
@@ -131,14 +144,19 @@ T *BP4Writer::BufferDataCommon(const size_t payloadPosition,
 }
 
 template <class T>
-void BP4Writer::PerformPutCommon(Variable<T> &variable)
+void BP4Writer::PerformPutCommon(Variable<T> &variable, const bool zeroCopy)
 {
     for (size_t b = 0; b < variable.m_BlocksInfo.size(); ++b)
     {
         auto itSpanBlock = variable.m_BlocksSpan.find(b);
         if (itSpanBlock == variable.m_BlocksSpan.end())
         {
-            PutSyncCommon(variable, variable.m_BlocksInfo[b], false);
+            const typename Variable<T>::Info &blockInfo =
+                variable.m_BlocksInfo[b];
+            PutSyncCommon(
+                variable, blockInfo, false,
+                zeroCopy && m_BP4Serializer.IsZeroCopyPayload(variable,
+                                                              blockInfo));
         }
         else
         {
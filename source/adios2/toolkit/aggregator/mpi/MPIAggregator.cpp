@@ -12,11 +12,45 @@
 
 #include "adios2/helper/adiosFunctions.h"
 
+#include <algorithm> //std::find, std::stable_sort
+#include <map>
+
 namespace adios2
 {
 namespace aggregator
 {
 
+namespace
+{
+
+/** node of each parent rank, identified by the lowest parent rank on it */
+std::vector<int> GatherNodes(helper::Comm const &parentComm)
+{
+    helper::Comm nodeComm =
+        parentComm.GroupByShm("creating node comm to assign aggregators");
+    const int node = nodeComm.BroadcastValue(parentComm.Rank(), 0);
+    return parentComm.AllGatherValues(node);
+}
+
+/** splits ranks in groups of consecutive ranks, the first groups get one
+ * more rank if the division is not exact */
+void AppendGroups(const std::vector<int> &ranks, const size_t count,
+                  std::vector<std::vector<int>> &groups)
+{
+    const size_t q = ranks.size() / count;
+    const size_t r = ranks.size() % count;
+
+    auto itRank = ranks.begin();
+    for (size_t g = 0; g < count; ++g)
+    {
+        const size_t size = (g < r) ? q + 1 : q;
+        groups.emplace_back(itRank, itRank + size);
+        itRank += size;
+    }
+}
+
+} // end anonymous namespace
+
 MPIAggregator::MPIAggregator() {}
 
 MPIAggregator::~MPIAggregator()
@@ -42,6 +76,92 @@ format::Buffer &MPIAggregator::GetConsumerBuffer(format::Buffer &buffer)
     return buffer;
 }
 
+bool MPIAggregator::Rebalance(const size_t bytes,
+                              helper::Comm const &parentComm)
+{
+    if (m_Assignment != Assignment::Balanced || !m_IsActive ||
+        m_SubStreams < 2)
+    {
+        return false;
+    }
+
+    if (m_ParentNodes.empty())
+    {
+        m_ParentNodes = GatherNodes(parentComm);
+    }
+
+    const std::vector<size_t> rankBytes = parentComm.AllGatherValues(bytes);
+    const std::vector<int> consumerRanks =
+        parentComm.AllGatherValues(m_ConsumerRank);
+    const std::vector<size_t> subStreamIndices =
+        parentComm.AllGatherValues(m_SubStreamIndex);
+
+    // consumers keep their own bytes
+    std::vector<size_t> loads(m_SubStreams, 0);
+    std::vector<int> consumers(m_SubStreams, -1);
+    std::vector<int> producers;
+    size_t producerBytes = 0;
+    for (size_t r = 0; r < consumerRanks.size(); ++r)
+    {
+        if (consumerRanks[r] == static_cast<int>(r))
+        {
+            consumers[subStreamIndices[r]] = consumerRanks[r];
+            loads[subStreamIndices[r]] += rankBytes[r];
+        }
+        else
+        {
+            producers.push_back(static_cast<int>(r));
+            producerBytes += rankBytes[r];
+        }
+    }
+
+    if (producerBytes == 0)
+    {
+        return false;
+    }
+
+    // largest producers first to the least loaded consumer, prefer a
+    // consumer on the same node on ties, same result on all ranks
+    std::stable_sort(producers.begin(), producers.end(),
+                     [&](const int a, const int b) {
+                         return rankBytes[a] > rankBytes[b];
+                     });
+
+    std::vector<int> newConsumerRanks(consumerRanks);
+    for (const int producer : producers)
+    {
+        auto lf_SameNode = [&](const size_t subStream) -> bool {
+            return m_ParentNodes[consumers[subStream]] ==
+                   m_ParentNodes[producer];
+        };
+
+        size_t best = 0;
+        for (size_t s = 1; s < m_SubStreams; ++s)
+        {
+            if (loads[s] < loads[best] ||
+                (loads[s] == loads[best] && lf_SameNode(s) &&
+                 !lf_SameNode(best)))
+            {
+                best = s;
+            }
+        }
+        loads[best] += rankBytes[producer];
+        newConsumerRanks[producer] = consumers[best];
+    }
+
+    if (newConsumerRanks == consumerRanks)
+    {
+        return false;
+    }
+
+    const int parentRank = parentComm.Rank();
+    m_ConsumerRank = newConsumerRanks[parentRank];
+    m_SubStreamIndex = subStreamIndices[m_ConsumerRank];
+    SplitComm(m_SubStreams, m_IsConsumer ? 0 : parentRank + 1, parentComm,
+              "rebalancing aggregators comm after flush");
+    return true;
+}
+
 void MPIAggregator::Close()
 {
     if (m_IsActive)
@@ -55,6 +175,12 @@ void MPIAggregator::Close()
 void MPIAggregator::InitComm(const size_t subStreams,
                              helper::Comm const &parentComm)
 {
+    if (m_Assignment != Assignment::Contiguous)
+    {
+        InitCommByNode(subStreams, parentComm);
+        return;
+    }
+
     int parentRank = parentComm.Rank();
     int parentSize = parentComm.Size();
 
@@ -81,19 +207,8 @@ void MPIAggregator::InitComm(const size_t subStreams,
         m_ConsumerRank = static_cast<int>(m_SubStreamIndex * (q + 1));
     }
 
-    m_Comm = parentComm.Split(m_ConsumerRank, parentRank,
-                              "creating aggregators comm with split at Open");
-
-    m_Rank = m_Comm.Rank();
-    m_Size = m_Comm.Size();
-
-    if (m_Rank != 0)
-    {
-        m_IsConsumer = false;
-    }
-
-    m_IsActive = true;
-    m_SubStreams = subStreams;
+    SplitComm(subStreams, parentRank, parentComm,
+              "creating aggregators comm with split at Open");
 }
 
 void MPIAggregator::InitCommOnePerNode(helper::Comm const &parentComm)
@@ -135,6 +250,104 @@ void MPIAggregator::InitCommOnePerNode(helper::Comm const &parentComm)
     m_ConsumerRank = m_Comm.BroadcastValue<int>(m_ConsumerRank, 0);
 }
 
+void MPIAggregator::InitCommByNode(const size_t subStreams,
+                                   helper::Comm const &parentComm)
+{
+    m_ParentNodes = GatherNodes(parentComm);
+
+    // nodes ordered by their lowest rank
+    std::map<int, std::vector<int>> nodeRanks;
+    for (size_t r = 0; r < m_ParentNodes.size(); ++r)
+    {
+        nodeRanks[m_ParentNodes[r]].push_back(static_cast<int>(r));
+    }
+
+    // ranks of each substream, consumer first
+    std::vector<std::vector<int>> groups;
+    groups.reserve(subStreams);
+
+    if (subStreams >= nodeRanks.size())
+    {
+        std::vector<const std::vector<int> *> nodes;
+        nodes.reserve(nodeRanks.size());
+        for (const auto &nodePair : nodeRanks)
+        {
+            nodes.push_back(&nodePair.second);
+        }
+
+        // one consumer per node, the rest to the nodes with the most ranks
+        // per consumer
+        std::vector<size_t> nodeConsumers(nodes.size(), 1);
+        for (size_t s = nodes.size(); s < subStreams; ++s)
+        {
+            size_t best = nodes.size();
+            for (size_t n = 0; n < nodes.size(); ++n)
+            {
+                if (nodeConsumers[n] == nodes[n]->size())
+                {
+                    continue;
+                }
+                if (best == nodes.size() ||
+                    nodes[n]->size() * (nodeConsumers[best] + 1) >
+                        nodes[best]->size() * (nodeConsumers[n] + 1))
+                {
+                    best = n;
+                }
+            }
+            ++nodeConsumers[best];
+        }
+
+        for (size_t n = 0; n < nodes.size(); ++n)
+        {
+            AppendGroups(*nodes[n], nodeConsumers[n], groups);
+        }
+    }
+    else
+    {
+        // fewer consumers than nodes, groups span consecutive nodes
+        std::vector<int> ranks;
+        ranks.reserve(m_ParentNodes.size());
+        for (const auto &nodePair : nodeRanks)
+        {
+            ranks.insert(ranks.end(), nodePair.second.begin(),
+                         nodePair.second.end());
+        }
+        AppendGroups(ranks, subStreams, groups);
+    }
+
+    const int parentRank = parentComm.Rank();
+    int key = 0;
+    for (size_t g = 0; g < groups.size(); ++g)
+    {
+        auto itRank =
+            std::find(groups[g].begin(), groups[g].end(), parentRank);
+        if (itRank != groups[g].end())
+        {
+            m_SubStreamIndex = g;
+            m_ConsumerRank = groups[g].front();
+            key = static_cast<int>(itRank - groups[g].begin());
+            break;
+        }
+    }
+
+    SplitComm(subStreams, key, parentComm,
+              "creating aggregators comm by node at Open");
+}
+
+void MPIAggregator::SplitComm(const size_t subStreams, const int key,
+                              helper::Comm const &parentComm,
+                              const std::string &hint)
+{
+    m_Comm = parentComm.Split(m_ConsumerRank, key, hint);
+
+    m_Rank = m_Comm.Rank();
+    m_Size = m_Comm.Size();
+    m_IsConsumer = (m_Rank == 0);
+
+    m_IsActive = true;
+    m_SubStreams = subStreams;
+}
+
 void MPIAggregator::HandshakeRank(const int rank)
 {
     int message = -1;
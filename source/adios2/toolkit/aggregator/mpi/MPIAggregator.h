@@ -12,6 +12,8 @@
 #define ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPIAGGREGATOR_H_
 
 #include <memory> //std::unique_ptr
+#include <string>
+#include <vector>
 
 #include "adios2/common/ADIOSTypes.h"
 #include "adios2/helper/adiosComm.h"
@@ -25,6 +27,20 @@ namespace aggregator
 class MPIAggregator
 {
 public:
+    /** policy assigning ranks of the parent communicator to substreams */
+    enum class Assignment
+    {
+        /** blocks of consecutive ranks */
+        Contiguous,
+        /** ranks grouped by node, consumers spread evenly over nodes */
+        Node,
+        /** Node, then producers moved to even out bytes after each flush */
+        Balanced
+    };
+
+    /** set before Init */
+    Assignment m_Assignment = Assignment::Contiguous;
+
     /** total number of substreams */
     size_t m_SubStreams = 0;
 
@@ -90,6 +106,17 @@ public:
 
     virtual format::Buffer &GetConsumerBuffer(format::Buffer &buffer);
 
+    /**
+     * Balanced assignment only: producers are reassigned so that all
+     * consumers write about the same number of bytes, based on the bytes of
+     * the last flush. Consumers and their substreams don't change. Collective
+     * on parentComm.
+     * @param bytes written by this rank in the last flush
+     * @param parentComm same communicator passed to Init
+     * @return true: m_Comm was split again
+     */
+    virtual bool Rebalance(const size_t bytes, helper::Comm const &parentComm);
+
     /** closes current aggregator, frees m_Comm */
     void Close();
 
@@ -102,11 +129,25 @@ protected:
      */
     void InitCommOnePerNode(helper::Comm const &parentComm);
 
+    /** Init m_Comm with ranks ordered by node, consumers spread evenly over
+     * nodes when there are at least as many subStreams as nodes */
+    void InitCommByNode(const size_t subStreams,
+                        helper::Comm const &parentComm);
+
+    /** Splits m_Comm from m_ConsumerRank, sets rank, size and consumer flag
+     * @param key order in m_Comm, the consumer must have the lowest */
+    void SplitComm(const size_t subStreams, const int key,
+                   helper::Comm const &parentComm, const std::string &hint);
+
     /** handshakes a single rank with the rest of the m_Comm ranks */
     void HandshakeRank(const int rank = 0);
 
     /** assigning extra buffers for aggregation */
     std::vector<std::unique_ptr<format::Buffer>> m_Buffers;
+
+    /** node of each parent rank, identified by its lowest parent rank, only
+     * used by Node and Balanced assignments */
+    std::vector<int> m_ParentNodes;
 };
 
 } // end namespace aggregator
@@ -0,0 +1,377 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPITwoLevel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "MPITwoLevel.h"
+
+#include "adios2/toolkit/format/buffer/heap/BufferSTL.h"
+#ifdef ADIOS2_HAVE_SYSVSHMEM
+#include "adios2/toolkit/format/buffer/ipc/BufferSystemV.h"
+#endif
+
+#include <cstring> // std::memcpy
+#include <numeric> // std::accumulate
+
+namespace adios2
+{
+namespace aggregator
+{
+
+MPITwoLevel::MPITwoLevel(const bool sharedMemory)
+: MPIAggregator(), m_SharedMemory(sharedMemory)
+{
+}
+
+void MPITwoLevel::Init(const size_t subStreams,
+                       helper::Comm const &parentComm)
+{
+    if (subStreams > 0)
+    {
+        InitComm(subStreams, parentComm);
+        HandshakeRank(0);
+    }
+    else
+    {
+        InitCommOnePerNode(parentComm);
+    }
+
+    InitNodeComms();
+
+    // 0: node buffer, 1-2: consumer receiving buffers, 3: empty
+    for (size_t i = 0; i < 4; ++i)
+    {
+        m_Buffers.emplace_back(new format::BufferSTL());
+    }
+}
+
+MPITwoLevel::ExchangeRequests MPITwoLevel::IExchange(format::Buffer &buffer,
+                                                     const int step)
+{
+    m_Step = step;
+    if (m_Size == 1)
+    {
+        return {};
+    }
+
+    if (step == 0)
+    {
+        const size_t nodeSize = GatherNode(buffer);
+
+        if (m_NodeComm.Rank() == 0)
+        {
+            const std::vector<size_t> nodeSizes =
+                m_LeadersComm.GatherValues(nodeSize, 0);
+            const std::vector<int> leaderRanks =
+                m_LeadersComm.GatherValues(m_Rank, 0);
+
+            if (m_IsConsumer)
+            {
+                m_Segments.clear();
+                for (size_t n = 0; n < nodeSizes.size(); ++n)
+                {
+                    if (nodeSizes[n] > 0)
+                    {
+                        m_Segments.push_back({leaderRanks[n], nodeSizes[n]});
+                    }
+                }
+            }
+            else if (nodeSize > 0)
+            {
+                m_SendRequest = m_Comm.Isend(
+                    m_Buffers[0]->Data(), nodeSize, 0, 1,
+                    ", aggregation Isend node data to consumer\n");
+            }
+        }
+    }
+
+    // receive the segment of the next step while the current one is written
+    if (m_IsConsumer && static_cast<size_t>(step) < m_Segments.size() &&
+        m_Segments[step].Source != 0)
+    {
+        IRecvSegment(static_cast<size_t>(step));
+    }
+
+    return {};
+}
+
+MPITwoLevel::ExchangeAbsolutePositionRequests
+MPITwoLevel::IExchangeAbsolutePosition(format::Buffer &buffer, const int step)
+{
+    if (m_Size == 1 || step != 0)
+    {
+        return {};
+    }
+
+    // same order as the data: consumer, rest of its node, other nodes
+    const size_t size = m_IsConsumer ? 0 : buffer.m_Position;
+    const std::vector<size_t> sizes = m_NodeComm.GatherValues(size, 0);
+
+    std::vector<size_t> starts;
+    size_t nodeStart = 0;
+    size_t end = 0;
+
+    if (m_NodeComm.Rank() == 0)
+    {
+        const size_t nodeSize =
+            std::accumulate(sizes.begin(), sizes.end(), size_t(0));
+        const std::vector<size_t> nodeSizes =
+            m_LeadersComm.GatherValues(nodeSize, 0);
+
+        std::vector<size_t> nodeStarts;
+        if (m_IsConsumer)
+        {
+            nodeStarts.reserve(nodeSizes.size());
+            end = buffer.m_AbsolutePosition;
+            for (const size_t s : nodeSizes)
+            {
+                nodeStarts.push_back(end);
+                end += s;
+            }
+        }
+
+        m_LeadersComm.Scatter(nodeStarts.data(), 1, &nodeStart, 1, 0,
+                              ", aggregation scatter node start positions\n");
+
+        starts.reserve(sizes.size());
+        size_t position = nodeStart;
+        for (const size_t s : sizes)
+        {
+            starts.push_back(position);
+            position += s;
+        }
+    }
+
+    size_t start = 0;
+    m_NodeComm.Scatter(starts.data(), 1, &start, 1, 0,
+                       ", aggregation scatter rank start positions\n");
+
+    buffer.m_AbsolutePosition = m_IsConsumer ? end : start;
+    return {};
+}
+
+void MPITwoLevel::Wait(ExchangeRequests & /*requests*/, const int step)
+{
+    if (m_Size == 1)
+    {
+        return;
+    }
+
+    if (m_IsConsumer)
+    {
+        m_RecvRequest.Wait(", aggregation waiting for node data at iteration " +
+                           std::to_string(step) + "\n");
+    }
+    else if (step == m_Size - 1)
+    {
+        m_SendRequest.Wait(", aggregation waiting for node data sent to "
+                           "consumer\n");
+    }
+}
+
+void MPITwoLevel::WaitAbsolutePosition(
+    ExchangeAbsolutePositionRequests & /*requests*/, const int /*step*/)
+{
+}
+
+void MPITwoLevel::ResetBuffers() noexcept
+{
+    m_Step = 0;
+    m_Segments.clear();
+}
+
+bool MPITwoLevel::Rebalance(const size_t bytes,
+                            helper::Comm const &parentComm)
+{
+    if (!MPIAggregator::Rebalance(bytes, parentComm))
+    {
+        return false;
+    }
+
+    InitNodeComms();
+    return true;
+}
+
+format::Buffer &MPITwoLevel::GetConsumerBuffer(format::Buffer &buffer)
+{
+    if (m_Step == 0)
+    {
+        return buffer;
+    }
+
+    const size_t segment = static_cast<size_t>(m_Step - 1);
+    if (segment < m_Segments.size())
+    {
+        return GetSegmentBuffer(segment);
+    }
+    // fewer segments than ranks, nothing to write
+    return *m_Buffers[3];
+}
+
+// PRIVATE
+void MPITwoLevel::InitNodeComms()
+{
+    // the consumer is rank 0 in both, it has the lowest rank in m_Comm
+    m_NodeComm =
+        m_Comm.GroupByShm("creating node comm, MPITwoLevel aggregator");
+    m_LeadersComm =
+        m_Comm.Split(m_NodeComm.Rank() == 0 ? 0 : 1, m_Rank,
+                     "creating leaders comm, MPITwoLevel aggregator");
+}
+
+size_t MPITwoLevel::GatherNode(format::Buffer &buffer)
+{
+    const size_t size = m_IsConsumer ? 0 : buffer.m_Position;
+    const std::vector<size_t> sizes = m_NodeComm.GatherValues(size, 0);
+
+#ifdef ADIOS2_HAVE_SYSVSHMEM
+    if (m_SharedMemory)
+    {
+        return GatherNodeSharedMemory(buffer, sizes);
+    }
+#endif
+
+    if (m_NodeComm.Rank() != 0)
+    {
+        if (size > 0)
+        {
+            helper::Comm::Req request = m_NodeComm.Isend(
+                buffer.Data(), size, 0, 0,
+                ", aggregation Isend data to node leader\n");
+            request.Wait(", aggregation waiting for data sent to node "
+                         "leader\n");
+        }
+        return size;
+    }
+
+    format::Buffer &nodeBuffer = *m_Buffers[0];
+    const size_t nodeSize =
+        std::accumulate(sizes.begin(), sizes.end(), size_t(0));
+    nodeBuffer.Resize(nodeSize, "in aggregation, when resizing node buffer "
+                                "to size " +
+                                    std::to_string(nodeSize));
+    nodeBuffer.m_Position = nodeSize;
+
+    if (size > 0)
+    {
+        std::memcpy(nodeBuffer.Data(), buffer.Data(), size);
+    }
+
+    std::vector<helper::Comm::Req> requests;
+    requests.reserve(sizes.size());
+    size_t position = size;
+    for (size_t i = 1; i < sizes.size(); ++i)
+    {
+        if (sizes[i] > 0)
+        {
+            requests.push_back(m_NodeComm.Irecv(
+                nodeBuffer.Data() + position, sizes[i], static_cast<int>(i), 0,
+                ", aggregation Irecv data from node rank " +
+                    std::to_string(i) + "\n"));
+            position += sizes[i];
+        }
+    }
+
+    for (auto &request : requests)
+    {
+        request.Wait(", aggregation waiting for node data\n");
+    }
+    return nodeSize;
+}
+
+#ifdef ADIOS2_HAVE_SYSVSHMEM
+size_t MPITwoLevel::GatherNodeSharedMemory(format::Buffer &buffer,
+                                           const std::vector<size_t> &sizes)
+{
+    const size_t size = m_IsConsumer ? 0 : buffer.m_Position;
+    const bool isLeader = (m_NodeComm.Rank() == 0);
+
+    std::vector<size_t> offsets;
+    size_t nodeSize = 0;
+    int shmID = -1;
+
+    if (isLeader)
+    {
+        offsets.reserve(sizes.size());
+        for (const size_t s : sizes)
+        {
+            offsets.push_back(nodeSize);
+            nodeSize += s;
+        }
+
+        // the segment is kept while it is large enough
+        if (nodeSize > m_Buffers[0]->m_FixedSize)
+        {
+            format::BufferSystemV *segment =
+                new format::BufferSystemV(nodeSize);
+            m_Buffers[0].reset(segment);
+            m_NodeShmID = segment->GetShmID();
+        }
+        m_Buffers[0]->m_Position = nodeSize;
+
+        if (nodeSize > 0)
+        {
+            shmID = m_NodeShmID;
+        }
+    }
+
+    shmID = m_NodeComm.BroadcastValue(shmID, 0);
+    if (shmID == -1)
+    {
+        return isLeader ? 0 : size;
+    }
+
+    size_t offset = 0;
+    m_NodeComm.Scatter(offsets.data(), 1, &offset, 1, 0,
+                       ", aggregation scatter node segment offsets\n");
+
+    if (size > 0)
+    {
+        if (isLeader)
+        {
+            std::memcpy(m_Buffers[0]->Data() + offset, buffer.Data(), size);
+        }
+        else
+        {
+            format::BufferSystemV segment(shmID, offset + size);
+            std::memcpy(segment.Data() + offset, buffer.Data(), size);
+        }
+    }
+
+    // all node ranks copied their data
+    m_NodeComm.Barrier(", aggregation waiting for node segment copies\n");
+    return isLeader ? nodeSize : size;
+}
+#endif
+
+void MPITwoLevel::IRecvSegment(const size_t segment)
+{
+    const Segment &source = m_Segments[segment];
+    format::Buffer &receiveBuffer = GetSegmentBuffer(segment);
+    receiveBuffer.Resize(source.Size,
+                         "in aggregation, when resizing receiving buffer to "
+                         "size " +
+                             std::to_string(source.Size));
+    receiveBuffer.m_Position = source.Size;
+
+    m_RecvRequest = m_Comm.Irecv(receiveBuffer.Data(), source.Size,
+                                 source.Source, 1,
+                                 ", aggregation Irecv node data from rank " +
+                                     std::to_string(source.Source) + "\n");
+}
+
+format::Buffer &MPITwoLevel::GetSegmentBuffer(const size_t segment)
+{
+    if (m_Segments[segment].Source == 0)
+    {
+        return *m_Buffers[0];
+    }
+    return *m_Buffers[1 + segment % 2];
+}
+
+} // end namespace aggregator
+} // end namespace adios2
@@ -0,0 +1,125 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPITwoLevel.h two-level aggregation: ranks on the same node gather their
+ * buffers to a node leader, node leaders send the gathered buffers directly
+ * to the substream consumer
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPITWOLEVEL_H_
+#define ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPITWOLEVEL_H_
+
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
+
+namespace adios2
+{
+namespace aggregator
+{
+
+/**
+ * Data lands in the file in node order, starting with the consumer's node,
+ * and in rank order within a node. The consumer writes one node per
+ * iteration while the next node is received in the background, instead of
+ * one rank per iteration relayed along a chain of m_Size ranks.
+ */
+class MPITwoLevel : public MPIAggregator
+{
+
+public:
+    /**
+     * @param sharedMemory true: node ranks copy their data to a shared memory
+     * segment of the node leader instead of sending it (SysV only)
+     */
+    MPITwoLevel(const bool sharedMemory = false);
+
+    ~MPITwoLevel() = default;
+
+    void Init(const size_t subStreams, helper::Comm const &parentComm) final;
+
+    ExchangeRequests IExchange(format::Buffer &buffer, const int step) final;
+
+    ExchangeAbsolutePositionRequests
+    IExchangeAbsolutePosition(format::Buffer &buffer, const int step) final;
+
+    void Wait(ExchangeRequests &requests, const int step) final;
+
+    void WaitAbsolutePosition(ExchangeAbsolutePositionRequests &requests,
+                              const int step) final;
+
+    void ResetBuffers() noexcept final;
+
+    format::Buffer &GetConsumerBuffer(format::Buffer &buffer) final;
+
+    bool Rebalance(const size_t bytes, helper::Comm const &parentComm) final;
+
+private:
+    /** node gather through shared memory */
+    const bool m_SharedMemory;
+
+    /** node leader: ID of the shared memory segment in m_Buffers[0] */
+    int m_NodeShmID = -1;
+
+    /** ranks of m_Comm on the same node, rank 0 is the node leader */
+    helper::Comm m_NodeComm;
+
+    /** node leaders of m_Comm, rank 0 is the consumer */
+    helper::Comm m_LeadersComm;
+
+    /** consumer only: data written at each step */
+    struct Segment
+    {
+        /** m_Comm rank sending the segment, 0: the consumer itself */
+        int Source;
+        size_t Size;
+    };
+    std::vector<Segment> m_Segments;
+
+    /** current step from IExchange */
+    int m_Step = 0;
+
+    /** leaders: send of the node buffer to the consumer */
+    helper::Comm::Req m_SendRequest;
+
+    /** consumer: receive of the segment for the next step */
+    helper::Comm::Req m_RecvRequest;
+
+    /** splits m_NodeComm and m_LeadersComm from m_Comm */
+    void InitNodeComms();
+
+    /**
+     * Node members send their buffer to the node leader, which gathers them
+     * in node rank order, the consumer's own buffer is not included
+     * @param buffer original buffer from serializer
+     * @return gathered bytes in the node leader, own bytes in other ranks
+     */
+    size_t GatherNode(format::Buffer &buffer);
+
+#ifdef ADIOS2_HAVE_SYSVSHMEM
+    /**
+     * GatherNode through a shared memory segment of the node leader, the
+     * consumer writes its node directly from the segment
+     * @param buffer original buffer from serializer
+     * @param sizes node leader: bytes of each node rank
+     * @return gathered bytes in the node leader, own bytes in other ranks
+     */
+    size_t GatherNodeSharedMemory(format::Buffer &buffer,
+                                  const std::vector<size_t> &sizes);
+#endif
+
+    /**
+     * Consumer: posts the receive of a segment from a node leader
+     * @param segment index in m_Segments
+     */
+    void IRecvSegment(const size_t segment);
+
+    /** leader buffer gathering the node, or consumer receiving buffer */
+    format::Buffer &GetSegmentBuffer(const size_t segment);
+};
+
+} // end namespace aggregator
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPITWOLEVEL_H_ */
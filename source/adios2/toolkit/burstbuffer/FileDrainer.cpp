@@ -10,10 +10,12 @@
 
 #include "FileDrainer.h"
 
+#include <algorithm> // std::remove_if
 #include <chrono>
 #include <cstdio>
 #include <cstring> // std::memcpy
 #include <thread>  // std::this_thread::sleep_for
+#include <vector>
 
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <ios> //std::ios_base::failure
@@ -24,6 +26,13 @@ namespace adios2
 namespace burstbuffer
 {
 
+namespace
+{
+// drainers detached from closed engines, joined at the end of the process
+std::mutex DetachedMutex;
+std::vector<std::unique_ptr<FileDrainer>> DetachedDrainers;
+}
+
 FileDrainOperation::FileDrainOperation(DrainOperation op,
                                        const std::string &fromFileName,
                                        const std::string &toFileName,
@@ -53,8 +62,7 @@ void FileDrainer::AddOperation(DrainOperation op,
 {
     FileDrainOperation operation(op, fromFileName, toFileName, countBytes,
                                  fromOffset, toOffset, data);
-    std::lock_guard<std::mutex> lockGuard(operationsMutex);
-    operations.push(operation);
+    AddOperation(operation);
 }
 
 void FileDrainer::AddOperationSeekEnd(const std::string &toFileName)
@@ -120,8 +128,64 @@ void FileDrainer::AddOperationDelete(const std::string &toFileName)
     AddOperation(DrainOperation::Delete, emptyStr, toFileName, 0, 0, 0);
 }
 
+void FileDrainer::AddOperationStepsDone(size_t steps)
+{
+    std::string emptyStr;
+    AddOperation(DrainOperation::StepsDone, emptyStr, emptyStr, 0, 0, steps);
+}
+
+void FileDrainer::SetMaxBandwidth(size_t bytesPerSecond)
+{
+    m_MaxBandwidth = bytesPerSecond;
+}
+
+size_t FileDrainer::GetDrainedSteps() const noexcept { return m_DrainedSteps; }
+
+bool FileDrainer::IsDone() const noexcept { return m_Done; }
+
+void FileDrainer::Detach(std::unique_ptr<FileDrainer> drainer)
+{
+    std::lock_guard<std::mutex> lockGuard(DetachedMutex);
+    auto itEnd = std::remove_if(
+        DetachedDrainers.begin(), DetachedDrainers.end(),
+        [](const std::unique_ptr<FileDrainer> &d) { return d->IsDone(); });
+    DetachedDrainers.erase(itEnd, DetachedDrainers.end());
+    DetachedDrainers.push_back(std::move(drainer));
+}
+
+void FileDrainer::JoinDetached()
+{
+    std::vector<std::unique_ptr<FileDrainer>> drainers;
+    {
+        std::lock_guard<std::mutex> lockGuard(DetachedMutex);
+        drainers.swap(DetachedDrainers);
+    }
+    for (auto &drainer : drainers)
+    {
+        drainer->Join();
+    }
+}
+
+void FileDrainer::StepsDone(size_t steps)
+{
+    if (steps <= m_DrainedSteps)
+    {
+        return;
+    }
+    const size_t bytes = m_BytesDrained;
+    if (m_Verbose)
+    {
+        std::cout << "Drain " << m_Rank << ": steps " << m_DrainedSteps
+                  << " to " << steps - 1 << " drained, "
+                  << bytes - m_BytesDrainedAtSteps << " bytes" << std::endl;
+    }
+    m_BytesDrainedAtSteps = bytes;
+    m_DrainedSteps = steps;
+}
+
 InputFile FileDrainer::GetFileForRead(const std::string &path)
 {
+    std::lock_guard<std::mutex> lockGuard(m_FileMapsMutex);
     auto it = m_InputFileMap.find(path);
     if (it != m_InputFileMap.end())
     {
@@ -138,6 +202,7 @@ InputFile FileDrainer::GetFileForRead(const std::string &path)
 
 OutputFile FileDrainer::GetFileForWrite(const std::string &path, bool append)
 {
+    std::lock_guard<std::mutex> lockGuard(m_FileMapsMutex);
     auto it = m_OutputFileMap.find(path);
     if (it != m_OutputFileMap.end())
     {
@@ -182,6 +247,7 @@ bool FileDrainer::Good(OutputFile &f) { return (f->good()); }
 
 void FileDrainer::CloseAll()
 {
+    std::lock_guard<std::mutex> lockGuard(m_FileMapsMutex);
     for (auto it = m_OutputFileMap.begin(); it != m_OutputFileMap.end(); ++it)
     {
         // if (it->second->good())
@@ -238,8 +304,7 @@ std::pair<size_t, double> FileDrainer::Read(InputFile &f, size_t count,
         {
             if (f->eof())
             {
-                std::chrono::duration<double> d(sleepUnit);
-                std::this_thread::sleep_for(d);
+                WaitForData(sleepUnit);
                 f->clear(f->rdstate() & ~std::fstream::eofbit);
                 totalSlept += sleepUnit;
             }
@@ -271,15 +336,47 @@ size_t FileDrainer::Write(OutputFile &f, size_t count, const char *buffer,
             " count = " + std::to_string(count) + " bytes\n");
     }
 
+    m_BytesDrained += count;
+    if (m_MaxBandwidth > 0)
+    {
+        Throttle(count);
+    }
     return count;
 }
 
+void FileDrainer::Throttle(size_t count)
+{
+    const std::chrono::duration<double> writeTime(
+        static_cast<double>(count) / static_cast<double>(m_MaxBandwidth));
+    std::chrono::steady_clock::time_point wakeUp;
+    {
+        // threads of a drainer share the bandwidth
+        std::lock_guard<std::mutex> lockGuard(m_ThrottleMutex);
+        const auto now = std::chrono::steady_clock::now();
+        if (m_ThrottleTime < now)
+        {
+            m_ThrottleTime = now;
+        }
+        m_ThrottleTime +=
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                writeTime);
+        wakeUp = m_ThrottleTime;
+    }
+    std::this_thread::sleep_until(wakeUp);
+}
+
 void FileDrainer::Delete(OutputFile &f, const std::string &path)
 {
     Close(f);
     std::remove(path.c_str());
 }
 
+void FileDrainer::WaitForData(const double seconds)
+{
+    std::chrono::duration<double> d(seconds);
+    std::this_thread::sleep_for(d);
+}
+
 void FileDrainer::SetVerbose(int verboseLevel, int rank)
 {
     m_Verbose = verboseLevel;
@@ -11,6 +11,8 @@
 #ifndef ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINER_H_
 #define ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINER_H_
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <locale>
@@ -40,7 +42,10 @@ enum class DrainOperation
     Write,   // Write data from memory to toFileName directly (without seek)
     Create,  // Open file for writing (creat) - only toFile
     Open,    // Open file for append - only toFile
-    Delete // Remove a file on disk (file will be opened if not already opened)
+    Delete, // Remove a file on disk (file will be opened if not already
+            // opened)
+    StepsDone // All operations of the first countBytes steps were added
+              // before this one (no file)
 };
 
 struct FileDrainOperation
@@ -70,7 +75,7 @@ public:
 
     virtual ~FileDrainer() = default;
 
-    void AddOperation(FileDrainOperation &operation);
+    virtual void AddOperation(FileDrainOperation &operation);
     void AddOperation(DrainOperation op, const std::string &fromFileName,
                       const std::string &toFileName, size_t fromOffset,
                       size_t toOffset, size_t countBytes,
@@ -90,6 +95,28 @@ public:
 
     void AddOperationDelete(const std::string &toFileName);
 
+    /** Mark that all operations of the first steps steps have been added */
+    void AddOperationStepsDone(size_t steps);
+
+    /** Limit the bytes written per second to the target, 0: unlimited */
+    void SetMaxBandwidth(size_t bytesPerSecond);
+
+    /** Number of steps whose operations have all been drained */
+    size_t GetDrainedSteps() const noexcept;
+
+    /** true when the thread(s) have finished all draining, does not block */
+    bool IsDone() const noexcept;
+
+    /**
+     * Keep a drainer running in the background after its owner is gone.
+     * Detached drainers are joined when they have finished and another one
+     * is detached, in JoinDetached, or at the end of the process.
+     */
+    static void Detach(std::unique_ptr<FileDrainer> drainer);
+
+    /** Join all detached drainers. Blocks until they have finished */
+    static void JoinDetached();
+
     /** Create thread */
     virtual void Start() = 0;
 
@@ -112,6 +139,15 @@ protected:
     int m_Verbose = 0;
     static const int errorState = -1;
 
+    /** set by the implementations when their thread(s) have finished */
+    std::atomic<bool> m_Done{false};
+
+    /** executes a StepsDone operation, updates progress */
+    void StepsDone(size_t steps);
+
+    /** Read waits for data still being written, sleeps by default */
+    virtual void WaitForData(const double seconds);
+
     /** instead for Open, use this function */
     InputFile GetFileForRead(const std::string &path);
     OutputFile GetFileForWrite(const std::string &path, bool append = false);
@@ -141,6 +177,20 @@ protected:
 private:
     InputFileMap m_InputFileMap;
     OutputFileMap m_OutputFileMap;
+    /** file maps are shared by the threads of a drainer */
+    std::mutex m_FileMapsMutex;
+    /** total bytes written to targets, for progress per step */
+    std::atomic<size_t> m_BytesDrained{0};
+    size_t m_BytesDrainedAtSteps = 0;
+    std::atomic<size_t> m_DrainedSteps{0};
+
+    /** bandwidth limit, writes wait until m_ThrottleTime */
+    size_t m_MaxBandwidth = 0;
+    std::mutex m_ThrottleMutex;
+    std::chrono::steady_clock::time_point m_ThrottleTime;
+    /** sleeps as long as writing count bytes takes at m_MaxBandwidth */
+    void Throttle(size_t count);
+
     void Open(InputFile &f, const std::string &path);
     void Close(InputFile &f);
     void Open(OutputFile &f, const std::string &path, bool append);
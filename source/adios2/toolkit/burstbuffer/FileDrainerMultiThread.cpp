@@ -0,0 +1,349 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileDrainerMultiThread.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "FileDrainerMultiThread.h"
+
+#include <algorithm> // std::min, std::max
+#include <chrono>
+#include <future> // std::async
+#include <iostream>
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+FileDrainerMultiThread::FileDrainerMultiThread(const size_t threads)
+: FileDrainer(), m_Threads(std::max<size_t>(threads, 1))
+{
+}
+
+FileDrainerMultiThread::~FileDrainerMultiThread() { Join(); }
+
+void FileDrainerMultiThread::SetBufferSize(size_t bufferSizeBytes)
+{
+    bufferSize = bufferSizeBytes;
+}
+
+void FileDrainerMultiThread::AddOperation(FileDrainOperation &operation)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueuesMutex);
+        m_FileQueues[operation.toFileName].emplace_back(m_NextSequence,
+                                                        operation);
+        m_Pending.insert(m_NextSequence);
+        ++m_NextSequence;
+        m_MaxQueueSize = std::max(m_MaxQueueSize, m_Pending.size());
+    }
+    m_QueuesCondition.notify_all();
+}
+
+void FileDrainerMultiThread::Start()
+{
+    m_Workers.reserve(m_Threads);
+    for (size_t t = 0; t < m_Threads; ++t)
+    {
+        m_Workers.emplace_back(&FileDrainerMultiThread::DrainThread, this);
+    }
+}
+
+void FileDrainerMultiThread::Finish()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueuesMutex);
+        m_Finish = true;
+    }
+    m_QueuesCondition.notify_all();
+}
+
+void FileDrainerMultiThread::Join()
+{
+    if (m_Workers.empty())
+    {
+        return;
+    }
+
+    const auto tTotalStart = std::chrono::steady_clock::now();
+    Finish();
+    for (std::thread &worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+
+    if (m_Verbose)
+    {
+        const std::chrono::duration<double> timeTotal =
+            std::chrono::steady_clock::now() - tTotalStart;
+        std::cout << "Drain " << m_Rank << ": " << m_Threads
+                  << " workers, waited for them to join = "
+                  << timeTotal.count() << " seconds. Max queue size = "
+                  << m_MaxQueueSize << ". Read " << m_BytesRead
+                  << " bytes. Wrote " << m_BytesWritten << " bytes.";
+        if (m_WaitedForData > 0.0)
+        {
+            std::cout << " Reads waited " << m_WaitedForData
+                      << " seconds for the data to arrive on disk.";
+        }
+        std::cout << std::endl;
+    }
+}
+
+void FileDrainerMultiThread::WaitForData(const double seconds)
+{
+    std::unique_lock<std::mutex> lock(m_QueuesMutex);
+    m_QueuesCondition.wait_for(lock, std::chrono::duration<double>(seconds));
+}
+
+// PRIVATE
+void FileDrainerMultiThread::DrainThread()
+{
+    // allocated at the first copy
+    std::vector<char> buffer;
+    std::vector<char> readAheadBuffer;
+
+    std::unique_lock<std::mutex> lock(m_QueuesMutex);
+    while (true)
+    {
+        auto itFile = NextFile();
+        if (itFile == m_FileQueues.end())
+        {
+            if (m_Finish && m_FileQueues.empty())
+            {
+                if (++m_FinishedWorkers == m_Threads)
+                {
+                    CloseAll();
+                    m_Done = true;
+                }
+                break;
+            }
+            m_QueuesCondition.wait(lock);
+            continue;
+        }
+
+        const std::string fileName = itFile->first;
+        // references to deque elements stay valid while others are added
+        std::pair<size_t, FileDrainOperation> &entry = itFile->second.front();
+        m_BusyFiles.insert(fileName);
+        m_LastFile = fileName;
+        lock.unlock();
+
+        double waitedForData = 0.0;
+        const std::pair<size_t, size_t> bytes =
+            Drain(entry.second, buffer, readAheadBuffer, waitedForData);
+
+        lock.lock();
+        m_BytesRead += bytes.first;
+        m_BytesWritten += bytes.second;
+        m_WaitedForData += waitedForData;
+        m_Pending.erase(entry.first);
+
+        itFile = m_FileQueues.find(fileName);
+        itFile->second.pop_front();
+        if (itFile->second.empty())
+        {
+            m_FileQueues.erase(itFile);
+        }
+        m_BusyFiles.erase(fileName);
+
+        // the next operation of the file or a waiting memory write can run
+        m_QueuesCondition.notify_all();
+    }
+}
+
+std::map<std::string,
+         std::deque<std::pair<size_t, FileDrainOperation>>>::iterator
+FileDrainerMultiThread::NextFile()
+{
+    auto itFile = m_FileQueues.upper_bound(m_LastFile);
+    for (size_t i = 0; i < m_FileQueues.size(); ++i, ++itFile)
+    {
+        if (itFile == m_FileQueues.end())
+        {
+            itFile = m_FileQueues.begin();
+        }
+        if (m_BusyFiles.count(itFile->first) > 0)
+        {
+            continue;
+        }
+
+        // writes from memory, deletes and step marks wait for all earlier
+        // operations
+        const std::pair<size_t, FileDrainOperation> &next =
+            itFile->second.front();
+        const bool isBarrier = (next.second.op == DrainOperation::Write ||
+                                next.second.op == DrainOperation::WriteAt ||
+                                next.second.op == DrainOperation::Delete ||
+                                next.second.op == DrainOperation::StepsDone);
+        if (!isBarrier || *m_Pending.begin() == next.first)
+        {
+            return itFile;
+        }
+    }
+    return m_FileQueues.end();
+}
+
+std::pair<size_t, size_t>
+FileDrainerMultiThread::Drain(FileDrainOperation &fdo,
+                              std::vector<char> &buffer,
+                              std::vector<char> &readAheadBuffer,
+                              double &waitedForData)
+{
+    size_t bytesRead = 0;
+    size_t bytesWritten = 0;
+
+    switch (fdo.op)
+    {
+
+    case DrainOperation::CopyAt:
+    case DrainOperation::Copy:
+    {
+        auto fdr = GetFileForRead(fdo.fromFileName);
+        const bool append = (fdo.op == DrainOperation::Copy);
+        auto fdw = GetFileForWrite(fdo.toFileName, append);
+
+        if (m_Verbose >= 2)
+        {
+            std::cout << "Drain " << m_Rank << ": Copy from "
+                      << fdo.fromFileName << " -> " << fdo.toFileName << " "
+                      << fdo.countBytes << " bytes";
+            if (!Good(fdr) || !Good(fdw))
+            {
+                std::cout << " -- Skip because of previous error";
+            }
+            std::cout << std::endl;
+        }
+
+        if (!Good(fdr) || !Good(fdw) || fdo.countBytes == 0)
+        {
+            break;
+        }
+
+        buffer.resize(std::min(bufferSize, fdo.countBytes));
+        readAheadBuffer.resize(buffer.size());
+        try
+        {
+            if (fdo.op == DrainOperation::CopyAt)
+            {
+                Seek(fdr, fdo.fromOffset, fdo.fromFileName);
+                Seek(fdw, fdo.toOffset, fdo.toFileName);
+            }
+
+            // the next batch is read while the current one is written
+            size_t remaining = fdo.countBytes;
+            size_t count = std::min(buffer.size(), remaining);
+            std::pair<size_t, double> ret =
+                Read(fdr, count, buffer.data(), fdo.fromFileName);
+            bytesRead += ret.first;
+            waitedForData += ret.second;
+            remaining -= count;
+
+            while (count > 0)
+            {
+                const size_t nextCount = std::min(buffer.size(), remaining);
+                std::future<std::pair<size_t, double>> readAhead;
+                if (nextCount > 0)
+                {
+                    readAhead = std::async(std::launch::async, [&]() {
+                        return Read(fdr, nextCount, readAheadBuffer.data(),
+                                    fdo.fromFileName);
+                    });
+                }
+
+                bytesWritten +=
+                    Write(fdw, count, buffer.data(), fdo.toFileName);
+
+                if (nextCount > 0)
+                {
+                    ret = readAhead.get();
+                    bytesRead += ret.first;
+                    waitedForData += ret.second;
+                    remaining -= nextCount;
+                    buffer.swap(readAheadBuffer);
+                }
+                count = nextCount;
+            }
+        }
+        catch (std::ios_base::failure &e)
+        {
+            std::cerr << "ADIOS THREAD ERROR: " << e.what() << std::endl;
+        }
+        break;
+    }
+    case DrainOperation::SeekEnd:
+    {
+        auto fdw = GetFileForWrite(fdo.toFileName);
+        SeekEnd(fdw);
+        break;
+    }
+    case DrainOperation::WriteAt:
+    case DrainOperation::Write:
+    {
+        if (m_Verbose >= 2)
+        {
+            std::cout << "Drain " << m_Rank << ": Write to file "
+                      << fdo.toFileName << " " << fdo.countBytes
+                      << " bytes of data from memory" << std::endl;
+        }
+        auto fdw = GetFileForWrite(fdo.toFileName);
+        if (fdo.op == DrainOperation::WriteAt)
+        {
+            Seek(fdw, fdo.toOffset, fdo.toFileName);
+        }
+        try
+        {
+            bytesWritten += Write(fdw, fdo.countBytes, fdo.dataToWrite.data(),
+                                  fdo.toFileName);
+        }
+        catch (std::ios_base::failure &e)
+        {
+            std::cerr << "ADIOS THREAD ERROR: " << e.what() << std::endl;
+        }
+        break;
+    }
+    case DrainOperation::Create:
+    {
+        GetFileForWrite(fdo.toFileName, false);
+        break;
+    }
+    case DrainOperation::Open:
+    {
+        GetFileForWrite(fdo.toFileName, true);
+        break;
+    }
+    case DrainOperation::Delete:
+    {
+        if (m_Verbose >= 2)
+        {
+            std::cout << "Drain " << m_Rank << ": Delete file "
+                      << fdo.toFileName << std::endl;
+        }
+        auto fdw = GetFileForWrite(fdo.toFileName, true);
+        Delete(fdw, fdo.toFileName);
+        break;
+    }
+    case DrainOperation::StepsDone:
+    {
+        StepsDone(fdo.countBytes);
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    return std::make_pair(bytesRead, bytesWritten);
+}
+
+} // end namespace burstbuffer
+} // end namespace adios2
@@ -0,0 +1,119 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileDrainerMultiThread.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_
+#define ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_
+
+#include "adios2/toolkit/burstbuffer/FileDrainer.h"
+
+#include <condition_variable>
+#include <deque>
+#include <set>
+#include <thread>
+#include <utility> // std::pair
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+/**
+ * Drains with a pool of worker threads. Operations are queued per target
+ * file and each file is drained by one worker at a time, so operations on a
+ * file keep their order while different files drain in parallel. Writes from
+ * memory (e.g. the metadata index) and deletes wait until all operations
+ * added before them are done, so drained metadata never refers to data not
+ * drained yet and burst buffer files are deleted after they are copied.
+ * Idle workers and workers waiting for data on the burst buffer are woken by
+ * new operations instead of polling.
+ */
+class FileDrainerMultiThread : public FileDrainer
+{
+
+public:
+    static const size_t defaultBufferSize = 16777216; // 16MB
+
+    /** @param threads number of drain workers, at least 1 */
+    FileDrainerMultiThread(const size_t threads);
+
+    ~FileDrainerMultiThread();
+
+    /** size of each of the two buffers of a worker */
+    void SetBufferSize(size_t bufferSizeBytes);
+
+    void AddOperation(FileDrainOperation &operation) final;
+
+    /** Create the worker threads */
+    void Start() final;
+
+    /** Tell workers to terminate when all draining has finished. */
+    void Finish() final;
+
+    /** Join the workers. Main thread will block until they terminate */
+    void Join() final;
+
+protected:
+    /** waits for new operations, the writer adds them after writing */
+    void WaitForData(const double seconds) final;
+
+private:
+    const size_t m_Threads;
+    size_t bufferSize = defaultBufferSize;
+    std::vector<std::thread> m_Workers;
+
+    /** protects all members below */
+    std::mutex m_QueuesMutex;
+    std::condition_variable m_QueuesCondition;
+    bool m_Finish = false;
+    /** the last worker to finish closes the files */
+    size_t m_FinishedWorkers = 0;
+
+    /** operations per target file, with their sequence number */
+    std::map<std::string,
+             std::deque<std::pair<size_t, FileDrainOperation>>>
+        m_FileQueues;
+
+    /** target files being drained by a worker */
+    std::set<std::string> m_BusyFiles;
+
+    /** sequence numbers of operations added and not done yet */
+    std::set<size_t> m_Pending;
+    size_t m_NextSequence = 0;
+
+    /** last file picked, the next worker starts searching after it */
+    std::string m_LastFile;
+
+    /** totals over all workers, for verbose output */
+    size_t m_BytesRead = 0;
+    size_t m_BytesWritten = 0;
+    size_t m_MaxQueueSize = 0;
+    double m_WaitedForData = 0.0;
+
+    void DrainThread(); // the worker function
+
+    /**
+     * Must be called with m_QueuesMutex locked
+     * @return iterator to a file whose next operation can run now, or
+     * m_FileQueues.end()
+     */
+    std::map<std::string,
+             std::deque<std::pair<size_t, FileDrainOperation>>>::iterator
+    NextFile();
+
+    /** executes one operation, returns bytes read and written */
+    std::pair<size_t, size_t> Drain(FileDrainOperation &fdo,
+                                     std::vector<char> &buffer,
+                                     std::vector<char> &readAheadBuffer,
+                                     double &waitedForData);
+};
+
+} // end namespace burstbuffer
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_ */
@@ -332,6 +332,11 @@ void FileDrainerSingleThread::DrainThread()
             timeWrite += te - ts;
             break;
         }
+        case DrainOperation::StepsDone:
+        {
+            StepsDone(fdo.countBytes);
+            break;
+        }
 
         default:
             break;
@@ -353,6 +358,7 @@ void FileDrainerSingleThread::DrainThread()
     CloseAll();
     te = std::chrono::steady_clock::now();
     timeClose += te - ts;
+    m_Done = true;
 
     const auto tTotalEnd = std::chrono::steady_clock::now();
     timeTotal = tTotalEnd - tTotalStart;
@@ -12,6 +12,8 @@
 #include "BPBase.tcc"
 
 #include "adios2/helper/adiosFunctions.h"
+#include "adios2/toolkit/aggregator/mpi/MPIChain.h"
+#include "adios2/toolkit/aggregator/mpi/MPITwoLevel.h"
 
 #include "adios2/toolkit/format/bp/bpOperation/compress/BPBZIP2.h"
 #include "adios2/toolkit/format/bp/bpOperation/compress/BPBlosc.h"
@@ -35,7 +37,8 @@ BPBase::SerialElementIndex::SerialElementIndex(const uint32_t memberID,
 
 BPBase::Minifooter::Minifooter(const int8_t version) : Version(version) {}
 
-BPBase::BPBase(helper::Comm const &comm) : m_Comm(comm)
+BPBase::BPBase(helper::Comm const &comm)
+: m_Comm(comm), m_Aggregator(new aggregator::MPIChain())
 {
     m_RankMPI = m_Comm.Rank();
     m_SizeMPI = m_Comm.Size();
@@ -120,6 +123,61 @@ void BPBase::Init(const Params &parameters, const std::string hint,
                 static_cast<unsigned int>(helper::StringTo<uint32_t>(
                     value, " in Parameter key=Threads " + hint));
         }
+        else if (key == "metadatathreads")
+        {
+            parsedParameters.MetadataThreads =
+                static_cast<unsigned int>(helper::StringTo<uint32_t>(
+                    value, " in Parameter key=MetadataThreads " + hint));
+        }
+        else if (key == "lazyvariables")
+        {
+            parsedParameters.LazyVariables = helper::StringTo<bool>(
+                value, " in Parameter key=LazyVariables " + hint);
+        }
+        else if (key == "metadatacache")
+        {
+            parsedParameters.MetadataCache = helper::StringTo<bool>(
+                value, " in Parameter key=MetadataCache " + hint);
+        }
+        else if (key == "nodebroadcast")
+        {
+            parsedParameters.NodeBroadcast = helper::StringTo<bool>(
+                value, " in Parameter key=NodeBroadcast " + hint);
+        }
+        else if (key == "asyncwrite")
+        {
+            parsedParameters.AsyncWrite = helper::StringTo<bool>(
+                value, " in Parameter key=AsyncWrite " + hint);
+        }
+        else if (key == "asyncwritemaxbuffersize")
+        {
+            parsedParameters.AsyncWriteMaxBufferSize =
+                helper::StringToByteUnits(
+                    value, "for Parameter key=AsyncWriteMaxBufferSize, in "
+                           "call to Open");
+        }
+        else if (key == "zerocopythreshold")
+        {
+            parsedParameters.ZeroCopyThreshold = helper::StringToByteUnits(
+                value, "for Parameter key=ZeroCopyThreshold, in call to Open");
+        }
+        else if (key == "bufferchunksize")
+        {
+            parsedParameters.BufferChunkSize = helper::StringToByteUnits(
+                value, "for Parameter key=BufferChunkSize, in call to Open");
+            if (parsedParameters.BufferChunkSize == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: value for Parameter key=BufferChunkSize must be "
+                    "greater than zero, " +
+                    hint);
+            }
+        }
+        else if (key == "bufferchunkhugepages")
+        {
+            parsedParameters.BufferChunkHugePages = helper::StringTo<bool>(
+                value, " in Parameter key=BufferChunkHugePages " + hint);
+        }
         else if (key == "asynctasks")
         {
             parsedParameters.AsyncTasks = helper::StringTo<bool>(
@@ -168,6 +226,54 @@ void BPBase::Init(const Params &parameters, const std::string hint,
             }
             parsedParameters.NumAggregators = n;
         }
+        else if (key == "aggregationtype")
+        {
+            if (value == "chain")
+            {
+                parsedParameters.Aggregation = AggregationType::Chain;
+            }
+            else if (value == "twolevel")
+            {
+                parsedParameters.Aggregation = AggregationType::TwoLevel;
+            }
+            else
+            {
+                throw std::invalid_argument(
+                    "ERROR: value for Parameter key=AggregationType must be "
+                    "Chain or TwoLevel, " +
+                    hint);
+            }
+        }
+        else if (key == "aggregationsharedmemory")
+        {
+            parsedParameters.AggregationSharedMemory = helper::StringTo<bool>(
+                value, " in Parameter key=AggregationSharedMemory " + hint);
+        }
+        else if (key == "substreamassignment")
+        {
+            if (value == "contiguous")
+            {
+                parsedParameters.SubStreamAssignment =
+                    aggregator::MPIAggregator::Assignment::Contiguous;
+            }
+            else if (value == "node")
+            {
+                parsedParameters.SubStreamAssignment =
+                    aggregator::MPIAggregator::Assignment::Node;
+            }
+            else if (value == "balanced")
+            {
+                parsedParameters.SubStreamAssignment =
+                    aggregator::MPIAggregator::Assignment::Balanced;
+            }
+            else
+            {
+                throw std::invalid_argument(
+                    "ERROR: value for Parameter key=SubStreamAssignment must "
+                    "be Contiguous, Node or Balanced, " +
+                    hint);
+            }
+        }
         else if (key == "aggregatorratio")
         {
             int ratio = static_cast<int>(helper::StringTo<int32_t>(
@@ -216,6 +322,31 @@ void BPBase::Init(const Params &parameters, const std::string hint,
                 static_cast<int>(helper::StringTo<int32_t>(
                     value, " in Parameter key=BurstBufferVerbose " + hint));
         }
+        else if (key == "burstbufferdrainthreads")
+        {
+            parsedParameters.BurstBufferDrainThreads =
+                static_cast<unsigned int>(helper::StringTo<uint32_t>(
+                    value, " in Parameter key=BurstBufferDrainThreads " +
+                               hint));
+            if (parsedParameters.BurstBufferDrainThreads == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: BurstBufferDrainThreads must be larger than 0 " +
+                    hint);
+            }
+        }
+        else if (key == "burstbufferdrainmaxbandwidth")
+        {
+            parsedParameters.BurstBufferDrainMaxBandwidth =
+                helper::StringToByteUnits(
+                    value, "for Parameter key=BurstBufferDrainMaxBandwidth, "
+                           "in call to Open");
+        }
+        else if (key == "burstbufferwaitfordrain")
+        {
+            parsedParameters.BurstBufferWaitForDrain = helper::StringTo<bool>(
+                value, " in Parameter key=BurstBufferWaitForDrain " + hint);
+        }
         else if (key == "streamreader")
         {
             parsedParameters.StreamReader = helper::StringTo<bool>(
@@ -253,6 +384,14 @@ void BPBase::Init(const Params &parameters, const std::string hint,
         }
         m_Parameters = parsedParameters;
     }
+
+    if (m_Parameters.Aggregation == AggregationType::TwoLevel)
+    {
+        m_Aggregator.reset(
+            new aggregator::MPITwoLevel(m_Parameters.AggregationSharedMemory));
+    }
+    m_Aggregator->m_Assignment = m_Parameters.SubStreamAssignment;
+
     // set timers if active
     if (m_Profiler.m_IsActive)
     {
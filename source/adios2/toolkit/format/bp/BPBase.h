@@ -20,7 +20,7 @@
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/common/ADIOSTypes.h"
 #include "adios2/helper/adiosComm.h"
-#include "adios2/toolkit/aggregator/mpi/MPIChain.h"
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
 #include "adios2/toolkit/format/bp/bpOperation/BPOperation.h"
 #include "adios2/toolkit/format/buffer/Buffer.h"
 #include "adios2/toolkit/profiling/iochrono/IOChrono.h"
@@ -55,6 +55,12 @@ public:
          * aggregation) */
         size_t LastUpdatedPosition = 0;
 
+        /**
+         * BP4 only: [begin, end) of the step headers written after
+         * LastUpdatedPosition, skipped in the offsets characteristics update
+         * when several steps are aggregated in one flush */
+        std::vector<std::pair<size_t, size_t>> StepHeaders;
+
         /**
          * flag indicating whether the variable is valid or not.
          * if it's not valid (meaning the variable is not put at current step
@@ -150,6 +156,13 @@ public:
         Minifooter(const int8_t version);
     };
 
+    /** strategy gathering the data of a substream at its consumer */
+    enum class AggregationType
+    {
+        Chain,   ///< buffers are relayed rank by rank, MPIChain
+        TwoLevel ///< gather per node, node leaders send to the consumer
+    };
+
     /** groups all user-level parameters in a single struct */
     struct Parameters
     {
@@ -186,6 +199,41 @@ public:
         /** might be used in large payload copies to buffer */
         unsigned int Threads = 1;
 
+        /** threads used to parse the variables metadata at read, BP4 only */
+        unsigned int MetadataThreads = 1;
+
+        /** true: variables are defined at first use after Open in
+         * random-access read mode, BP4 only */
+        bool LazyVariables = false;
+
+        /** true: BP4 readers load variables metadata from a cache file
+         * next to md.idx, created by the first reader of a complete file */
+        bool MetadataCache = false;
+
+        /** true: BP4 readers broadcast metadata read by rank 0 to one
+         * process per compute node first, then within each node */
+        bool NodeBroadcast = false;
+
+        /** true: BP4 writers write the data buffer in a background thread
+         * while the application fills a second buffer */
+        bool AsyncWrite = false;
+
+        /** largest data buffer written in the background with AsyncWrite,
+         * larger buffers are written synchronously */
+        size_t AsyncWriteMaxBufferSize = DefaultMaxBufferSize;
+
+        /** deferred payloads of at least this size are written by BP4
+         * writers directly from user memory instead of being copied into the
+         * data buffer, default: never */
+        size_t ZeroCopyThreshold = MaxSizeT;
+
+        /** size of the chunks of chunked buffers, e.g. the buffer collecting
+         * aggregated data for AsyncWrite */
+        size_t BufferChunkSize = DefaultBufferChunkSize;
+
+        /** true: chunks are backed by transparent huge pages if available */
+        bool BufferChunkHugePages = false;
+
         /** default time unit in m_Profiler */
         TimeUnit ProfileUnit = DefaultTimeUnitEnum;
 
@@ -211,6 +259,18 @@ public:
         /** Verbose level for burst buffer draining thread */
         int BurstBufferVerbose = 0;
 
+        /** Burst buffer draining threads per aggregator, 1: single thread
+         * draining all files in order */
+        unsigned int BurstBufferDrainThreads = 1;
+
+        /** Bytes per second each aggregator may write to the target while
+         * draining the burst buffer, 0: unlimited */
+        size_t BurstBufferDrainMaxBandwidth = 0;
+
+        /** true: Close waits until the burst buffer is drained, false: a
+         * drain still running finishes in the background */
+        bool BurstBufferWaitForDrain = true;
+
         /** Stream reader flag: process metadata step-by-step
          * instead of parsing everything available
          */
@@ -222,6 +282,16 @@ public:
          * aggregators
          */
         unsigned int NumAggregators = 0;
+
+        /** how ranks send their data to the aggregators */
+        AggregationType Aggregation = AggregationType::Chain;
+
+        /** TwoLevel: gather node data in a shared memory segment */
+        bool AggregationSharedMemory = false;
+
+        /** how ranks are assigned to substreams */
+        aggregator::MPIAggregator::Assignment SubStreamAssignment =
+            aggregator::MPIAggregator::Assignment::Contiguous;
     };
 
     /** Return type of the ResizeBuffer function. */
@@ -268,8 +338,9 @@ public:
     /** if reader and writer have different ordering (column vs row major) */
     bool m_ReverseDimensions = false;
 
-    /** manages all communication tasks in aggregation */
-    aggregator::MPIChain m_Aggregator;
+    /** manages all communication tasks in aggregation, MPIChain unless set
+     * by the AggregationType parameter */
+    std::unique_ptr<aggregator::MPIAggregator> m_Aggregator;
 
     /** tracks Put and Get variables in deferred mode */
     std::set<std::string> m_DeferredVariables;
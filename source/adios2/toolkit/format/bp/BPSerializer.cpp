@@ -316,9 +316,18 @@ void BPSerializer::UpdateOffsetsInMetadata()
         const DataTypes dataTypeEnum = static_cast<DataTypes>(header.DataType);
 
         size_t &currentPosition = index.LastUpdatedPosition;
+        auto itStepHeader = index.StepHeaders.begin();
 
         while (currentPosition < buffer.size())
         {
+            if (itStepHeader != index.StepHeaders.end() &&
+                currentPosition == itStepHeader->first)
+            {
+                currentPosition = itStepHeader->second;
+                ++itStepHeader;
+                continue;
+            }
+
             switch (dataTypeEnum)
             {
 
@@ -347,10 +356,11 @@ void BPSerializer::UpdateOffsetsInMetadata()
 
             } // end switch
         }
+        index.StepHeaders.clear();
     };
 
     // BODY OF FUNCTION STARTS HERE
-    if (m_Aggregator.m_IsConsumer)
+    if (m_Aggregator->m_IsConsumer)
     {
         return;
     }
@@ -727,9 +737,9 @@ void BPSerializer::MergeSerializeIndices(
 
 uint32_t BPSerializer::GetFileIndex() const noexcept
 {
-    if (m_Aggregator.m_IsActive)
+    if (m_Aggregator->m_IsActive)
     {
-        return static_cast<uint32_t>(m_Aggregator.m_SubStreamIndex);
+        return static_cast<uint32_t>(m_Aggregator->m_SubStreamIndex);
     }
 
     return static_cast<uint32_t>(m_RankMPI);
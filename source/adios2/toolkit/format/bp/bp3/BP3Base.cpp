@@ -161,7 +161,8 @@ std::string BP3Base::GetBPSubStreamName(const std::string &name,
 
     const size_t index =
         isReader ? id
-                 : m_Aggregator.m_IsActive ? m_Aggregator.m_SubStreamIndex : id;
+                 : m_Aggregator->m_IsActive ? m_Aggregator->m_SubStreamIndex
+                                            : id;
 
     const std::string bpRankName(bpName + ".dir" + PathSeparator + bpRoot +
                                  "." + std::to_string(index));
@@ -136,7 +136,7 @@ void BP3Serializer::CloseData(core::IO &io)
             m_Profiler.m_Bytes.at("buffering") = m_Data.m_AbsolutePosition;
         }
 
-        m_Aggregator.Close();
+        m_Aggregator->Close();
         m_IsClosed = true;
     }
 
@@ -106,6 +106,15 @@ std::string BP4Base::GetBPActiveFlagFileName(const std::string &name) const
     return bpMetaDataIndexRankName;
 }
 
+std::string BP4Base::GetBPMetadataCacheFileName(const std::string &name) const
+    noexcept
+{
+    const std::string bpName = helper::RemoveTrailingSlash(name);
+    /* the name of the metadata cache file is "md.cache" */
+    const std::string bpMetadataCacheName(bpName + PathSeparator + "md.cache");
+    return bpMetadataCacheName;
+}
+
 std::vector<std::string>
 BP4Base::GetBPSubStreamNames(const std::vector<std::string> &names) const
     noexcept
@@ -211,7 +220,8 @@ std::string BP4Base::GetBPSubStreamName(const std::string &name,
 
     const size_t index =
         isReader ? id
-                 : m_Aggregator.m_IsActive ? m_Aggregator.m_SubStreamIndex : id;
+                 : m_Aggregator->m_IsActive ? m_Aggregator->m_SubStreamIndex
+                                            : id;
 
     /* the name of a data file starts with "data." */
     const std::string bpRankName(bpName + PathSeparator + "data." +
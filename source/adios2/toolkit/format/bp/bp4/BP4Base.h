@@ -55,12 +55,17 @@ public:
 
     BufferSTL m_MetadataIndex;
 
+    /** data files are written with the striped file transport, recorded in
+     * the Index Table header so readers open them with it */
+    bool m_StripedData = false;
+
     /** Positions of flags in Index Table Header that Reader uses */
     static constexpr size_t m_IndexHeaderSize = 64;
     static constexpr size_t m_IndexRecordSize = 64;
     static constexpr size_t m_EndianFlagPosition = 36;
     static constexpr size_t m_BPVersionPosition = 37;
     static constexpr size_t m_ActiveFlagPosition = 38;
+    static constexpr size_t m_StripedFlagPosition = 39;
     static constexpr size_t m_VersionTagPosition = 0;
     static constexpr size_t m_VersionTagLength = 32;
 
@@ -110,6 +115,9 @@ public:
 
     std::string GetBPActiveFlagFileName(const std::string &name) const noexcept;
 
+    std::string GetBPMetadataCacheFileName(const std::string &name) const
+        noexcept;
+
     std::string GetBPSubFileName(const std::string &name,
                                  const size_t subFileIndex,
                                  const bool hasSubFiles = true,
@@ -13,6 +13,7 @@
 #include "BP4Deserializer.h"
 #include "BP4Deserializer.tcc"
 
+#include <algorithm> //std::min
 #include <future>
 #include <unordered_set>
 #include <vector>
@@ -32,6 +33,15 @@ namespace format
 
 std::mutex BP4Deserializer::m_Mutex;
 
+namespace
+{
+/* md.cache header: magic, version, host endianness, md.cache size, md.0 size,
+ * md.idx size, number of variables, followed by a copy of md.idx */
+const std::string MetadataCacheMagic("ADIOS2 BP4 CACHE");
+constexpr uint8_t MetadataCacheVersion = 1;
+constexpr size_t MetadataCacheHeaderSize = 16 + 2 + 4 * 8;
+}
+
 BP4Deserializer::BP4Deserializer(helper::Comm const &comm)
 : BP4Base(comm), BPBase(comm), m_Minifooter(4)
 {
@@ -39,13 +49,50 @@ BP4Deserializer::BP4Deserializer(helper::Comm const &comm)
 
 size_t BP4Deserializer::ParseMetadata(const BufferSTL &bufferSTL,
                                       core::Engine &engine,
-                                      const bool firstStep)
+                                      const bool firstStep,
+                                      const bool parseVariables)
 {
     const size_t oldSteps = (firstStep ? 0 : m_MetadataSet.StepsCount);
     size_t allSteps = m_MetadataIndexTable[0].size();
     m_MetadataSet.StepsCount = allSteps;
     m_MetadataSet.CurrentStep = allSteps - 1;
     size_t lastposition = 0;
+
+    // variables are defined on first use only when opening
+    const bool lazyVariables =
+        firstStep && parseVariables && m_Parameters.LazyVariables;
+
+    if ((m_Parameters.MetadataThreads > 1 || lazyVariables ||
+         !parseVariables) &&
+        allSteps > oldSteps)
+    {
+        for (size_t i = oldSteps; i < allSteps; i++)
+        {
+            ParsePGIndexPerStep(bufferSTL, engine.m_IO.m_HostLanguage, 0,
+                                i + 1);
+        }
+
+        if (lazyVariables)
+        {
+            ReadVariablesIndexPositions(bufferSTL, 0, oldSteps + 1,
+                                        allSteps + 1, m_LazyVariables);
+        }
+        else if (parseVariables)
+        {
+            VariablesIndexPositions variablesPositions;
+            ReadVariablesIndexPositions(bufferSTL, 0, oldSteps + 1,
+                                        allSteps + 1, variablesPositions);
+            DefineVariablesInEngineIO(engine, bufferSTL.m_Buffer,
+                                      variablesPositions);
+        }
+
+        for (size_t i = oldSteps; i < allSteps; i++)
+        {
+            ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
+        }
+        return m_MetadataIndexTable[0][allSteps][3];
+    }
+
     /* parse the metadata step by step using the pointers saved in the metadata
     index table */
     for (size_t i = oldSteps; i < allSteps; i++)
@@ -108,6 +155,12 @@ void BP4Deserializer::ParseMetadataIndex(BufferSTL &bufferSTL,
             buffer, position, m_Minifooter.IsLittleEndian);
         m_WriterIsActive = (activeChar == '\1' ? true : false);
 
+        // Data files written with the striped transport
+        position = m_StripedFlagPosition;
+        const uint8_t stripedFlag = helper::ReadValue<uint8_t>(
+            buffer, position, m_Minifooter.IsLittleEndian);
+        m_StripedData = (stripedFlag == 1);
+
         // move position to first row
         position = 64;
     }
@@ -157,6 +210,24 @@ const helper::BlockOperationInfo &BP4Deserializer::InitPostOperatorBlockData(
     return blockOperationsInfo.at(index);
 }
 
+void BP4Deserializer::GetPayloadRange(
+    const helper::SubStreamBoxInfo &subStreamBoxInfo, size_t &payloadSize,
+    size_t &payloadOffset) const
+{
+    if (subStreamBoxInfo.OperationsInfo.size() > 0)
+    {
+        const helper::BlockOperationInfo &blockOperationInfo =
+            InitPostOperatorBlockData(subStreamBoxInfo.OperationsInfo);
+        payloadSize = blockOperationInfo.PayloadSize;
+        payloadOffset = blockOperationInfo.PayloadOffset;
+    }
+    else
+    {
+        payloadOffset = subStreamBoxInfo.Seeks.first;
+        payloadSize = subStreamBoxInfo.Seeks.second - payloadOffset;
+    }
+}
+
 /* void BP4Deserializer::GetPreOperatorBlockData(
     const std::vector<char> &postOpData,
     const helper::BlockOperationInfo &blockOperationInfo,
@@ -291,28 +362,6 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
                                                  size_t submetadatafileId,
                                                  size_t step)
 {
-    auto lf_ReadElementIndexPerStep = [&](core::Engine &engine,
-                                          const std::vector<char> &buffer,
-                                          size_t position, size_t step) {
-        const ElementIndexHeader header = ReadElementIndexHeader(
-            buffer, position, m_Minifooter.IsLittleEndian);
-
-        switch (header.DataType)
-        {
-
-#define make_case(T)                                                           \
-    case (TypeTraits<T>::type_enum):                                           \
-    {                                                                          \
-        DefineVariableInEngineIOPerStep<T>(header, engine, buffer, position,   \
-                                           step);                              \
-        break;                                                                 \
-    }
-            ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
-#undef make_case
-
-        } // end switch
-    };
-
     const auto &buffer = bufferSTL.m_Buffer;
     size_t position = m_MetadataIndexTable[submetadatafileId][step][1];
 
@@ -325,13 +374,15 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
     size_t localPosition = 0;
 
     /* FIXME: multi-threaded processing does not work here
-     * because DefineVariable may be called from several threads
+     * because DefineVariable may be called from several threads,
+     * see DefineVariablesInEngineIO for multi-threaded parsing across
+     * variables
      */
     /*if (m_Threads == 1)*/
     {
         while (localPosition < length)
         {
-            lf_ReadElementIndexPerStep(engine, buffer, position, step);
+            DefineVariableInEngineIOPerStep(engine, buffer, position, step);
 
             const size_t elementIndexSize =
                 static_cast<size_t>(helper::ReadValue<uint32_t>(
@@ -386,6 +437,338 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
     */
 }
 
+void BP4Deserializer::ReadVariablesIndexPositions(
+    const BufferSTL &bufferSTL, size_t submetadatafileId, size_t stepStart,
+    size_t stepEnd, VariablesIndexPositions &variablesPositions)
+{
+    /* variable name, position of its element index in a step */
+    using ElementPositions = std::vector<std::pair<std::string, size_t>>;
+
+    const auto &buffer = bufferSTL.m_Buffer;
+    const size_t stepsCount = stepEnd - stepStart;
+
+    // index table is not thread-safe, get variables index starts first
+    std::vector<size_t> stepPositions(stepsCount);
+    for (size_t s = 0; s < stepsCount; ++s)
+    {
+        stepPositions[s] =
+            m_MetadataIndexTable[submetadatafileId][stepStart + s][1];
+    }
+
+    // collect element index positions of each step in parallel
+    auto lf_ReadElementPositions = [&](const size_t s,
+                                       ElementPositions &elementPositions) {
+        size_t position = stepPositions[s];
+        helper::ReadValue<uint32_t>(buffer, position,
+                                    m_Minifooter.IsLittleEndian);
+        const uint64_t length = helper::ReadValue<uint64_t>(
+            buffer, position, m_Minifooter.IsLittleEndian);
+
+        const size_t startPosition = position;
+        while (position - startPosition < length)
+        {
+            size_t headerPosition = position;
+            const ElementIndexHeader header = ReadElementIndexHeader(
+                buffer, headerPosition, m_Minifooter.IsLittleEndian);
+            elementPositions.emplace_back(
+                header.Path.empty() ? header.Name
+                                    : header.Path + PathSeparator + header.Name,
+                position);
+
+            const size_t elementIndexSize =
+                static_cast<size_t>(helper::ReadValue<uint32_t>(
+                    buffer, position, m_Minifooter.IsLittleEndian));
+            position += elementIndexSize;
+        }
+    };
+
+    std::vector<ElementPositions> stepsElementPositions(stepsCount);
+    auto lf_ReadStepsElementPositions = [&](const size_t t,
+                                            const size_t threads) {
+        for (size_t s = t; s < stepsCount; s += threads)
+        {
+            lf_ReadElementPositions(s, stepsElementPositions[s]);
+        }
+    };
+
+    const size_t threads =
+        std::min(static_cast<size_t>(m_Parameters.MetadataThreads), stepsCount);
+
+    if (threads <= 1)
+    {
+        lf_ReadStepsElementPositions(0, 1);
+    }
+    else
+    {
+        std::vector<std::future<void>> asyncs;
+        asyncs.reserve(threads);
+        for (size_t t = 0; t < threads; ++t)
+        {
+            asyncs.push_back(std::async(std::launch::async,
+                                        lf_ReadStepsElementPositions, t,
+                                        threads));
+        }
+        for (auto &async : asyncs)
+        {
+            async.get();
+        }
+    }
+
+    // merge in step order
+    for (size_t s = 0; s < stepsCount; ++s)
+    {
+        for (const auto &elementPosition : stepsElementPositions[s])
+        {
+            variablesPositions[elementPosition.first].emplace_back(
+                stepStart + s, elementPosition.second);
+        }
+    }
+}
+
+void BP4Deserializer::DefineVariablesInEngineIO(
+    core::Engine &engine, const std::vector<char> &buffer,
+    const VariablesIndexPositions &variablesPositions) const
+{
+    std::vector<const std::vector<std::pair<size_t, size_t>> *> variables;
+    variables.reserve(variablesPositions.size());
+    for (const auto &variablePositions : variablesPositions)
+    {
+        variables.push_back(&variablePositions.second);
+    }
+
+    const size_t threads = std::min(
+        static_cast<size_t>(m_Parameters.MetadataThreads), variables.size());
+
+    auto lf_DefineVariables = [&](const size_t t, const size_t threads) {
+        for (size_t v = t; v < variables.size(); v += threads)
+        {
+            for (const auto &stepPosition : *variables[v])
+            {
+                DefineVariableInEngineIOPerStep(engine, buffer,
+                                                stepPosition.second,
+                                                stepPosition.first);
+            }
+        }
+    };
+
+    if (threads <= 1)
+    {
+        lf_DefineVariables(0, 1);
+        return;
+    }
+
+    std::vector<std::future<void>> asyncs;
+    asyncs.reserve(threads);
+    for (size_t t = 0; t < threads; ++t)
+    {
+        asyncs.push_back(
+            std::async(std::launch::async, lf_DefineVariables, t, threads));
+    }
+    for (auto &async : asyncs)
+    {
+        async.get();
+    }
+}
+
+bool BP4Deserializer::DefineLazyVariable(core::Engine &engine,
+                                         const std::string &name)
+{
+    auto itVariable = m_LazyVariables.find(name);
+    if (itVariable == m_LazyVariables.end())
+    {
+        return false;
+    }
+
+    // remove first, the IO asks again while the variable is being defined
+    const std::vector<std::pair<size_t, size_t>> stepsPositions =
+        std::move(itVariable->second);
+    m_LazyVariables.erase(itVariable);
+
+    for (const auto &stepPosition : stepsPositions)
+    {
+        DefineVariableInEngineIOPerStep(engine, m_Metadata.m_Buffer,
+                                        stepPosition.second,
+                                        stepPosition.first);
+    }
+    return true;
+}
+
+void BP4Deserializer::DefineLazyVariables(core::Engine &engine)
+{
+    if (m_LazyVariables.empty())
+    {
+        return;
+    }
+
+    VariablesIndexPositions variablesPositions;
+    std::swap(variablesPositions, m_LazyVariables);
+    DefineVariablesInEngineIO(engine, m_Metadata.m_Buffer, variablesPositions);
+}
+
+bool BP4Deserializer::IsValidMetadataCache(
+    const std::vector<char> &cache) const noexcept
+{
+    const std::vector<char> &metadataIndex = m_MetadataIndex.m_Buffer;
+    if (cache.size() < MetadataCacheHeaderSize + metadataIndex.size() ||
+        std::string(cache.data(), MetadataCacheMagic.size()) !=
+            MetadataCacheMagic)
+    {
+        return false;
+    }
+
+    const bool isLittleEndian = helper::IsLittleEndian();
+    size_t position = MetadataCacheMagic.size();
+    const uint8_t version =
+        helper::ReadValue<uint8_t>(cache, position, isLittleEndian);
+    const uint8_t littleEndian =
+        helper::ReadValue<uint8_t>(cache, position, isLittleEndian);
+    const uint64_t cacheSize =
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian);
+    const uint64_t metadataSize =
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian);
+    const uint64_t metadataIndexSize =
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian);
+
+    // md.idx has a timestamp per step, a file written again with the same
+    // metadata sizes is not mistaken for the cached one
+    return version == MetadataCacheVersion &&
+           (littleEndian == 1) == isLittleEndian &&
+           cacheSize == cache.size() &&
+           metadataSize == m_Metadata.m_Buffer.size() &&
+           metadataIndexSize == metadataIndex.size() &&
+           std::equal(metadataIndex.begin(), metadataIndex.end(),
+                      cache.begin() + MetadataCacheHeaderSize);
+}
+
+std::vector<char>
+BP4Deserializer::SerializeMetadataCache(core::IO &io) const
+{
+    const core::VarMap &variables = io.GetVariables();
+    const std::vector<char> &metadataIndex = m_MetadataIndex.m_Buffer;
+
+    std::vector<char> cache;
+    cache.reserve(MetadataCacheHeaderSize + metadataIndex.size() +
+                  variables.size() * 256);
+    helper::InsertToBuffer(cache, MetadataCacheMagic.data(),
+                           MetadataCacheMagic.size());
+    helper::InsertToBuffer(cache, &MetadataCacheVersion);
+    const uint8_t littleEndian = helper::IsLittleEndian() ? 1 : 0;
+    helper::InsertToBuffer(cache, &littleEndian);
+    // cache size, updated at the end
+    helper::InsertU64(cache, 0);
+    helper::InsertU64(cache, m_Metadata.m_Buffer.size());
+    helper::InsertU64(cache, metadataIndex.size());
+    helper::InsertU64(cache, variables.size());
+    helper::InsertToBuffer(cache, metadataIndex.data(), metadataIndex.size());
+
+    for (const auto &variablePair : variables)
+    {
+        const DataType type = variablePair.second->m_Type;
+
+        if (type == DataType::Compound)
+        {
+        }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        PutVariableMetadataCache(                                              \
+            dynamic_cast<const core::Variable<T> &>(*variablePair.second),     \
+            cache);                                                            \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+#undef declare_type
+    }
+
+    size_t position = MetadataCacheMagic.size() + 2;
+    const uint64_t cacheSize = static_cast<uint64_t>(cache.size());
+    helper::CopyToBuffer(cache, position, &cacheSize);
+    return cache;
+}
+
+void BP4Deserializer::DefineVariablesFromMetadataCache(
+    core::Engine &engine, const std::vector<char> &cache) const
+{
+    const bool isLittleEndian = helper::IsLittleEndian();
+    size_t position = MetadataCacheHeaderSize - 8;
+    const size_t variablesCount = static_cast<size_t>(
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+    position += m_MetadataIndex.m_Buffer.size();
+
+    for (size_t v = 0; v < variablesCount; ++v)
+    {
+        const std::string variableName =
+            ReadMetadataCacheValue<std::string>(cache, position);
+        const DataType type = static_cast<DataType>(
+            helper::ReadValue<uint8_t>(cache, position, isLittleEndian));
+
+        if (type == DataType::Compound)
+        {
+        }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        DefineVariableFromMetadataCache<T>(engine, variableName, cache,        \
+                                           position);                          \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+#undef declare_type
+        else
+        {
+            throw std::runtime_error("ERROR: invalid type of variable " +
+                                     variableName +
+                                     " in metadata cache, in call to Open\n");
+        }
+    }
+}
+
+void BP4Deserializer::PutMetadataCacheDims(const Dims &dims,
+                                           std::vector<char> &cache) const
+{
+    helper::InsertU64(cache, dims.size());
+    for (const size_t dimension : dims)
+    {
+        helper::InsertU64(cache, dimension);
+    }
+}
+
+Dims BP4Deserializer::ReadMetadataCacheDims(const std::vector<char> &cache,
+                                            size_t &position) const
+{
+    const bool isLittleEndian = helper::IsLittleEndian();
+    const size_t ndims = static_cast<size_t>(
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+    Dims dims(ndims);
+    for (size_t &dimension : dims)
+    {
+        dimension = static_cast<size_t>(
+            helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+    }
+    return dims;
+}
+
+void BP4Deserializer::DefineVariableInEngineIOPerStep(
+    core::Engine &engine, const std::vector<char> &buffer, size_t position,
+    size_t step) const
+{
+    const ElementIndexHeader header =
+        ReadElementIndexHeader(buffer, position, m_Minifooter.IsLittleEndian);
+
+    switch (header.DataType)
+    {
+
+#define make_case(T)                                                           \
+    case (TypeTraits<T>::type_enum):                                           \
+    {                                                                          \
+        DefineVariableInEngineIOPerStep<T>(header, engine, buffer, position,   \
+                                           step);                              \
+        break;                                                                 \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
+#undef make_case
+
+    } // end switch
+}
+
 /* void BP4Deserializer::ParseVariablesIndex(const BufferSTL &bufferSTL,
                                           core::IO &io)
 {
@@ -632,6 +1015,38 @@ void BP4Deserializer::ClipMemory(const std::string &variableName, core::IO &io,
 #undef declare_type
 }
 
+void BP4Deserializer::ResetVariable(core::VariableBase &variable,
+                                    const Dims &shape, const Dims &start,
+                                    const Dims &count) const
+{
+    variable.m_Shape = shape;
+    variable.m_Start = start;
+    variable.m_Count = count;
+    variable.m_MemoryStart.clear();
+    variable.m_MemoryCount.clear();
+
+    if (shape.empty())
+    {
+        variable.m_ShapeID =
+            count.empty() ? ShapeID::GlobalValue : ShapeID::LocalArray;
+    }
+    else
+    {
+        variable.m_ShapeID = ShapeID::GlobalArray;
+    }
+    variable.m_SingleValue = (variable.m_ShapeID == ShapeID::GlobalValue);
+
+    variable.m_SelectionType = SelectionType::BoundingBox;
+    variable.m_BlockID = 0;
+    variable.m_ReadAsJoined = false;
+    variable.m_ReadAsLocalValue = false;
+    variable.m_RandomAccess = true;
+    variable.m_FirstStreamingStep = true;
+    variable.m_AvailableStepsStart = 0;
+    variable.m_StepsStart = 0;
+    variable.m_StepsCount = 1;
+}
+
 bool BP4Deserializer::ReadActiveFlag(std::vector<char> &buffer)
 {
     if (buffer.size() < m_ActiveFlagPosition)
@@ -697,7 +1112,12 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
                                                                                \
     template void BP4Deserializer::PostDataRead(                               \
         core::Variable<T> &, typename core::Variable<T>::Info &,               \
-        const helper::SubStreamBoxInfo &, const bool, const size_t);
+        const helper::SubStreamBoxInfo &, const bool, const size_t);           \
+                                                                               \
+    template void BP4Deserializer::PostDataRead(                               \
+        core::Variable<T> &, typename core::Variable<T>::Info &,               \
+        const helper::SubStreamBoxInfo &, const bool, const char *, T *,       \
+        const size_t);
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
@@ -56,7 +56,8 @@ public:
      * contains K steps when the reader looks at it).
      */
     size_t ParseMetadata(const BufferSTL &bufferSTL, core::Engine &engine,
-                         const bool firstStep = true);
+                         const bool firstStep = true,
+                         const bool parseVariables = true);
 
     /**
      * Used to get the variable payload data for the current selection (dims and
@@ -119,6 +120,32 @@ public:
                       const bool isRowMajorDestination,
                       const size_t threadID = 0);
 
+    /**
+     * Same as PostDataRead, but takes the raw payload read from the transport
+     * manager from an external memory location instead of the thread buffers.
+     * Used for coalesced reads of several boxes in a single transport call.
+     * @param payload raw data as read from the range given by
+     * GetPayloadRange
+     * @param destination user memory for the current block and step
+     * @param threadID independent raw memory spaces per thread (operations)
+     */
+    template <class T>
+    void PostDataRead(core::Variable<T> &variable,
+                      typename core::Variable<T>::Info &blockInfo,
+                      const helper::SubStreamBoxInfo &subStreamBoxInfo,
+                      const bool isRowMajorDestination, const char *payload,
+                      T *destination, const size_t threadID);
+
+    /**
+     * Gets the absolute range in a substream holding the raw payload of a
+     * box (block), without allocating any memory for it
+     * @param subStreamBoxInfo input box information
+     * @param payloadSize output size to be read
+     * @param payloadOffset output absolute position in substream
+     */
+    void GetPayloadRange(const helper::SubStreamBoxInfo &subStreamBoxInfo,
+                         size_t &payloadSize, size_t &payloadOffset) const;
+
     /**
      * Clips and assigns memory to blockInfo.Data from a contiguous memory
      * input
@@ -179,12 +206,65 @@ public:
 
     bool ReadActiveFlag(std::vector<char> &buffer);
 
+    /**
+     * <pre>
+     * key: variable name
+     * value: (step, position of variable index element in metadata) for each
+     * step with the variable
+     * </pre>
+     */
+    using VariablesIndexPositions =
+        std::map<std::string, std::vector<std::pair<size_t, size_t>>>;
+
+    /**
+     * Defines a variable from metadata parsed in Open with the LazyVariables
+     * parameter, when it is used for the first time
+     * @param engine reader engine with the IO to define the variable in
+     * @param name variable name
+     * @return true: variable was defined, false: not a lazy variable
+     */
+    bool DefineLazyVariable(core::Engine &engine, const std::string &name);
+
+    /**
+     * Defines all remaining variables parsed with the LazyVariables parameter
+     * @param engine reader engine with the IO to define variables in
+     */
+    void DefineLazyVariables(core::Engine &engine);
+
+    /**
+     * Checks if a metadata cache (md.cache) was created from the current
+     * m_MetadataIndex and m_Metadata on a host with the same endianness
+     * @param cache metadata cache file content
+     * @return true: cache can be used, false: cache must be created again
+     */
+    bool IsValidMetadataCache(const std::vector<char> &cache) const noexcept;
+
+    /**
+     * Serializes the variables defined by ParseMetadata from m_Metadata into
+     * a metadata cache, see DefineVariablesFromMetadataCache
+     * @param io with all variables defined
+     * @return metadata cache file content
+     */
+    std::vector<char> SerializeMetadataCache(core::IO &io) const;
+
+    /**
+     * Defines variables in engine IO from a metadata cache, replaces parsing
+     * the variables index of all steps in ParseMetadata
+     * @param engine reader engine with the IO to define variables in
+     * @param cache valid metadata cache, see IsValidMetadataCache
+     */
+    void DefineVariablesFromMetadataCache(core::Engine &engine,
+                                          const std::vector<char> &cache) const;
+
     // TODO: will deprecate
     bool m_PerformedGets = false;
 
 private:
     std::map<std::string, helper::SubFileInfoMap> m_DeferredVariablesMap;
 
+    /** variables not yet defined in IO with LazyVariables */
+    VariablesIndexPositions m_LazyVariables;
+
     static std::mutex m_Mutex;
 
     void ParseMinifooter(const BufferSTL &bufferSTL);
@@ -199,6 +279,47 @@ private:
                                     core::Engine &engine,
                                     size_t submetadatafileId, size_t step);
 
+    /**
+     * Collects the positions of the variables index elements of steps
+     * [stepStart, stepEnd), reading steps with m_Parameters.MetadataThreads
+     * @param bufferSTL metadata buffer
+     * @param submetadatafileId metadata file
+     * @param stepStart first step to read (starting at 1)
+     * @param stepEnd one past the last step to read
+     * @param variablesPositions output, steps are appended in order for each
+     * variable
+     */
+    void
+    ReadVariablesIndexPositions(const BufferSTL &bufferSTL,
+                                size_t submetadatafileId, size_t stepStart,
+                                size_t stepEnd,
+                                VariablesIndexPositions &variablesPositions);
+
+    /**
+     * Defines variables from their index element positions with
+     * m_Parameters.MetadataThreads. Each variable is defined and updated by a
+     * single thread with its steps in order, so the result is the same as
+     * calling ParseVariablesIndexPerStep for each step
+     * @param engine reader engine with the IO to define variables in
+     * @param buffer metadata buffer
+     * @param variablesPositions from ReadVariablesIndexPositions
+     */
+    void DefineVariablesInEngineIO(
+        core::Engine &engine, const std::vector<char> &buffer,
+        const VariablesIndexPositions &variablesPositions) const;
+
+    /**
+     * Reads the header of a variable index element and calls the typed
+     * DefineVariableInEngineIOPerStep
+     * @param engine reader engine with the IO to define variables in
+     * @param buffer metadata buffer
+     * @param position start of variable index element
+     * @param step current step (starting at 1)
+     */
+    void DefineVariableInEngineIOPerStep(core::Engine &engine,
+                                         const std::vector<char> &buffer,
+                                         size_t position, size_t step) const;
+
     // void ParseAttributesIndex(const BufferSTL &bufferSTL, core::IO &io);
     void ParseAttributesIndexPerStep(const BufferSTL &bufferSTL,
                                      core::Engine &engine,
@@ -219,6 +340,41 @@ private:
                                          const std::vector<char> &buffer,
                                          size_t position, size_t step) const;
 
+    /**
+     * Resets a Variable left from previous steps in streaming mode to the
+     * state of a newly defined Variable, to avoid removing and defining all
+     * Variables again at every step
+     * @param variable existing variable without available steps
+     * @param shape new shape as in DefineVariable
+     * @param start new start as in DefineVariable
+     * @param count new count as in DefineVariable
+     */
+    void ResetVariable(core::VariableBase &variable, const Dims &shape,
+                       const Dims &start, const Dims &count) const;
+
+    template <class T>
+    void PutVariableMetadataCache(const core::Variable<T> &variable,
+                                  std::vector<char> &cache) const;
+
+    template <class T>
+    void DefineVariableFromMetadataCache(core::Engine &engine,
+                                         const std::string &variableName,
+                                         const std::vector<char> &cache,
+                                         size_t &position) const;
+
+    template <class T>
+    void PutMetadataCacheValue(const T &value, std::vector<char> &cache) const;
+
+    template <class T>
+    T ReadMetadataCacheValue(const std::vector<char> &cache,
+                             size_t &position) const;
+
+    void PutMetadataCacheDims(const Dims &dims,
+                              std::vector<char> &cache) const;
+
+    Dims ReadMetadataCacheDims(const std::vector<char> &cache,
+                               size_t &position) const;
+
     template <class T>
     void DefineAttributeInEngineIO(const ElementIndexHeader &header,
                                    core::Engine &engine,
@@ -288,7 +444,12 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
                                                                                \
     extern template void BP4Deserializer::PostDataRead(                        \
         core::Variable<T> &, typename core::Variable<T>::Info &,               \
-        const helper::SubStreamBoxInfo &, const bool, const size_t);
+        const helper::SubStreamBoxInfo &, const bool, const size_t);           \
+                                                                               \
+    extern template void BP4Deserializer::PostDataRead(                        \
+        core::Variable<T> &, typename core::Variable<T>::Info &,               \
+        const helper::SubStreamBoxInfo &, const bool, const char *, T *,       \
+        const size_t);
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
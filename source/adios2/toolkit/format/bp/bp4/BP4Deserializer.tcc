@@ -512,30 +512,55 @@ void BP4Deserializer::PostDataRead(
     const helper::SubStreamBoxInfo &subStreamBoxInfo,
     const bool isRowMajorDestination, const size_t threadID)
 {
-    if (subStreamBoxInfo.OperationsInfo.size() > 0 &&
-        !IdentityOperation<T>(blockInfo.Operations))
-    {
-        const helper::BlockOperationInfo &blockOperationInfo =
-            InitPostOperatorBlockData(subStreamBoxInfo.OperationsInfo);
+    const bool hasOperation = subStreamBoxInfo.OperationsInfo.size() > 0 &&
+                              !IdentityOperation<T>(blockInfo.Operations);
+    const char *payload = hasOperation ? m_ThreadBuffers[threadID][1].data()
+                                       : m_ThreadBuffers[threadID][0].data();
 
-        const size_t preOpPayloadSize =
-            helper::GetTotalSize(blockOperationInfo.PreCount) *
-            blockOperationInfo.PreSizeOf;
-        m_ThreadBuffers[threadID][0].resize(preOpPayloadSize);
-
-        // get the right bp4Op
-        std::shared_ptr<BPOperation> bp4Op =
-            SetBPOperation(blockOperationInfo.Info.at("Type"));
+    PostDataRead(variable, blockInfo, subStreamBoxInfo, isRowMajorDestination,
+                 payload, blockInfo.Data, threadID);
+}
 
-        // get original block back
-        char *preOpData = m_ThreadBuffers[threadID][0].data();
-        const char *postOpData = m_ThreadBuffers[threadID][1].data();
-        bp4Op->GetData(postOpData, blockOperationInfo, preOpData);
+template <class T>
+void BP4Deserializer::PostDataRead(
+    core::Variable<T> &variable, typename core::Variable<T>::Info &blockInfo,
+    const helper::SubStreamBoxInfo &subStreamBoxInfo,
+    const bool isRowMajorDestination, const char *payload, T *destination,
+    const size_t threadID)
+{
+    const char *contiguousMemory = payload;
 
-        // clip block to match selection
-        helper::ClipVector(m_ThreadBuffers[threadID][0],
-                           subStreamBoxInfo.Seeks.first,
-                           subStreamBoxInfo.Seeks.second);
+    if (subStreamBoxInfo.OperationsInfo.size() > 0)
+    {
+        if (IdentityOperation<T>(blockInfo.Operations))
+        {
+            // payload is the entire block, skip to the selection start
+            contiguousMemory = payload + subStreamBoxInfo.Seeks.first;
+        }
+        else
+        {
+            const helper::BlockOperationInfo &blockOperationInfo =
+                InitPostOperatorBlockData(subStreamBoxInfo.OperationsInfo);
+
+            const size_t preOpPayloadSize =
+                helper::GetTotalSize(blockOperationInfo.PreCount) *
+                blockOperationInfo.PreSizeOf;
+            m_ThreadBuffers[threadID][0].resize(preOpPayloadSize);
+
+            // get the right bp4Op
+            std::shared_ptr<BPOperation> bp4Op =
+                SetBPOperation(blockOperationInfo.Info.at("Type"));
+
+            // get original block back
+            char *preOpData = m_ThreadBuffers[threadID][0].data();
+            bp4Op->GetData(payload, blockOperationInfo, preOpData);
+
+            // clip block to match selection
+            helper::ClipVector(m_ThreadBuffers[threadID][0],
+                               subStreamBoxInfo.Seeks.first,
+                               subStreamBoxInfo.Seeks.second);
+            contiguousMemory = m_ThreadBuffers[threadID][0].data();
+        }
     }
 
 #ifdef ADIOS2_HAVE_ENDIAN_REVERSE
@@ -552,10 +577,9 @@ void BP4Deserializer::PostDataRead(
             : blockInfo.Start;
 
     helper::ClipContiguousMemory(
-        blockInfo.Data, blockInfoStart, blockInfo.Count,
-        m_ThreadBuffers[threadID][0].data(), subStreamBoxInfo.BlockBox,
-        subStreamBoxInfo.IntersectionBox, m_IsRowMajor, m_ReverseDimensions,
-        endianReverse);
+        destination, blockInfoStart, blockInfo.Count, contiguousMemory,
+        subStreamBoxInfo.BlockBox, subStreamBoxInfo.IntersectionBox,
+        m_IsRowMajor, m_ReverseDimensions, endianReverse);
 }
 
 template <class T>
@@ -640,8 +664,12 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
                             : header.Path + PathSeparator + header.Name;
 
     core::Variable<std::string> *variable = nullptr;
-    variable = engine.m_IO.InquireVariable<std::string>(variableName);
-    if (variable)
+    {
+        // to prevent conflict with DefineVariable
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        variable = engine.m_IO.InquireVariable<std::string>(variableName);
+    }
+    if (variable && !variable->m_AvailableStepBlockIndexOffsets.empty())
     {
         size_t endPositionCurrentStep =
             initialPosition -
@@ -687,8 +715,15 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
 
     if (characteristics.Statistics.IsValue)
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        variable = &engine.m_IO.DefineVariable<std::string>(variableName);
+        if (variable)
+        {
+            ResetVariable(*variable, Dims(), Dims(), Dims());
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            variable = &engine.m_IO.DefineVariable<std::string>(variableName);
+        }
         variable->m_Value =
             characteristics.Statistics.Value; // assigning first step
 
@@ -795,7 +830,9 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         variable = engine.m_IO.InquireVariable<T>(variableName);
     }
 
-    if (variable)
+    // variable without available steps is reused from a previous
+    // streaming step, see ResetVariable
+    if (variable && !variable->m_AvailableStepBlockIndexOffsets.empty())
     {
         size_t endPositionCurrentStep =
             initialPosition -
@@ -868,41 +905,34 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
 
     {
         std::lock_guard<std::mutex> lock(m_Mutex);
+        Dims shape, start, count;
         switch (characteristics.EntryShapeID)
         {
         case (ShapeID::GlobalValue):
         {
-            variable = &engine.m_IO.DefineVariable<T>(variableName);
             break;
         }
         case (ShapeID::GlobalArray):
         {
-            const Dims shape = m_ReverseDimensions
-                                   ? Dims(characteristics.Shape.rbegin(),
-                                          characteristics.Shape.rend())
-                                   : characteristics.Shape;
-
-            variable = &engine.m_IO.DefineVariable<T>(
-                variableName, shape, Dims(shape.size(), 0), shape);
-            variable->m_AvailableShapes[characteristics.Statistics.Step] =
-                variable->m_Shape;
+            shape = m_ReverseDimensions ? Dims(characteristics.Shape.rbegin(),
+                                               characteristics.Shape.rend())
+                                        : characteristics.Shape;
+            start = Dims(shape.size(), 0);
+            count = shape;
             break;
         }
         case (ShapeID::LocalValue):
         {
-            variable =
-                &engine.m_IO.DefineVariable<T>(variableName, {1}, {0}, {1});
-            variable->m_ShapeID = ShapeID::LocalValue;
+            shape = {1};
+            start = {0};
+            count = {1};
             break;
         }
         case (ShapeID::LocalArray):
         {
-            const Dims count = m_ReverseDimensions
-                                   ? Dims(characteristics.Count.rbegin(),
-                                          characteristics.Count.rend())
-                                   : characteristics.Count;
-            variable =
-                &engine.m_IO.DefineVariable<T>(variableName, {}, {}, count);
+            count = m_ReverseDimensions ? Dims(characteristics.Count.rbegin(),
+                                               characteristics.Count.rend())
+                                        : characteristics.Count;
             break;
         }
         default:
@@ -911,6 +941,26 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
                 variableName + ", in call to Open\n");
         } // end switch
 
+        if (variable)
+        {
+            ResetVariable(*variable, shape, start, count);
+        }
+        else
+        {
+            variable = &engine.m_IO.DefineVariable<T>(variableName, shape,
+                                                      start, count);
+        }
+
+        if (characteristics.EntryShapeID == ShapeID::GlobalArray)
+        {
+            variable->m_AvailableShapes[characteristics.Statistics.Step] =
+                variable->m_Shape;
+        }
+        else if (characteristics.EntryShapeID == ShapeID::LocalValue)
+        {
+            variable->m_ShapeID = ShapeID::LocalValue;
+        }
+
         if (characteristics.Statistics.IsValue)
         {
             variable->m_Value = characteristics.Statistics.Value;
@@ -1021,6 +1071,151 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
     variable->m_Engine = &engine;
 }
 
+template <class T>
+void BP4Deserializer::PutMetadataCacheValue(const T &value,
+                                            std::vector<char> &cache) const
+{
+    helper::InsertToBuffer(cache, &value);
+}
+
+template <>
+inline void
+BP4Deserializer::PutMetadataCacheValue(const std::string &value,
+                                       std::vector<char> &cache) const
+{
+    helper::InsertU64(cache, value.size());
+    helper::InsertToBuffer(cache, value.data(), value.size());
+}
+
+template <class T>
+T BP4Deserializer::ReadMetadataCacheValue(const std::vector<char> &cache,
+                                          size_t &position) const
+{
+    T value;
+    helper::CopyFromBuffer(cache, position, &value);
+    return value;
+}
+
+template <>
+inline std::string
+BP4Deserializer::ReadMetadataCacheValue(const std::vector<char> &cache,
+                                        size_t &position) const
+{
+    const size_t length = static_cast<size_t>(helper::ReadValue<uint64_t>(
+        cache, position, helper::IsLittleEndian()));
+    const std::string value(cache.data() + position, length);
+    position += length;
+    return value;
+}
+
+template <class T>
+void BP4Deserializer::PutVariableMetadataCache(
+    const core::Variable<T> &variable, std::vector<char> &cache) const
+{
+    PutMetadataCacheValue(variable.m_Name, cache);
+    const uint8_t type = static_cast<uint8_t>(variable.m_Type);
+    helper::InsertToBuffer(cache, &type);
+    const uint8_t shapeID = static_cast<uint8_t>(variable.m_ShapeID);
+    helper::InsertToBuffer(cache, &shapeID);
+    const uint8_t singleValue = variable.m_SingleValue ? 1 : 0;
+    helper::InsertToBuffer(cache, &singleValue);
+
+    PutMetadataCacheDims(variable.m_Shape, cache);
+    PutMetadataCacheDims(variable.m_Start, cache);
+    PutMetadataCacheDims(variable.m_Count, cache);
+
+    PutMetadataCacheValue(variable.m_Value, cache);
+    PutMetadataCacheValue(variable.m_Min, cache);
+    PutMetadataCacheValue(variable.m_Max, cache);
+
+    helper::InsertU64(cache, variable.m_IndexStart);
+    helper::InsertU64(cache, variable.m_AvailableStepsCount);
+
+    helper::InsertU64(cache, variable.m_AvailableStepBlockIndexOffsets.size());
+    for (const auto &stepPositions : variable.m_AvailableStepBlockIndexOffsets)
+    {
+        helper::InsertU64(cache, stepPositions.first);
+        helper::InsertU64(cache, stepPositions.second.size());
+        for (const size_t position : stepPositions.second)
+        {
+            helper::InsertU64(cache, position);
+        }
+    }
+
+    helper::InsertU64(cache, variable.m_AvailableShapes.size());
+    for (const auto &stepShape : variable.m_AvailableShapes)
+    {
+        helper::InsertU64(cache, stepShape.first);
+        PutMetadataCacheDims(stepShape.second, cache);
+    }
+}
+
+template <class T>
+void BP4Deserializer::DefineVariableFromMetadataCache(
+    core::Engine &engine, const std::string &variableName,
+    const std::vector<char> &cache, size_t &position) const
+{
+    const bool isLittleEndian = helper::IsLittleEndian();
+
+    const ShapeID shapeID = static_cast<ShapeID>(
+        helper::ReadValue<uint8_t>(cache, position, isLittleEndian));
+    const bool singleValue =
+        helper::ReadValue<uint8_t>(cache, position, isLittleEndian) == 1;
+
+    // dimensions are assigned as found by ParseMetadata, which are not
+    // always valid DefineVariable arguments (e.g. string local values)
+    core::Variable<T> &variable = engine.m_IO.DefineVariable<T>(variableName);
+    variable.m_ShapeID = shapeID;
+    variable.m_SingleValue = singleValue;
+    variable.m_Shape = ReadMetadataCacheDims(cache, position);
+    variable.m_Start = ReadMetadataCacheDims(cache, position);
+    variable.m_Count = ReadMetadataCacheDims(cache, position);
+
+    variable.m_Value = ReadMetadataCacheValue<T>(cache, position);
+    variable.m_Min = ReadMetadataCacheValue<T>(cache, position);
+    variable.m_Max = ReadMetadataCacheValue<T>(cache, position);
+
+    variable.m_IndexStart = static_cast<size_t>(
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+    variable.m_AvailableStepsCount = static_cast<size_t>(
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+
+    const size_t steps = static_cast<size_t>(
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+    for (size_t s = 0; s < steps; ++s)
+    {
+        const size_t step = static_cast<size_t>(
+            helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+        const size_t blocks = static_cast<size_t>(
+            helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+
+        std::vector<size_t> &positions =
+            variable.m_AvailableStepBlockIndexOffsets[step];
+        positions.reserve(blocks);
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            positions.push_back(static_cast<size_t>(
+                helper::ReadValue<uint64_t>(cache, position, isLittleEndian)));
+        }
+    }
+
+    const size_t shapes = static_cast<size_t>(
+        helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+    for (size_t s = 0; s < shapes; ++s)
+    {
+        const size_t step = static_cast<size_t>(
+            helper::ReadValue<uint64_t>(cache, position, isLittleEndian));
+        variable.m_AvailableShapes[step] =
+            ReadMetadataCacheDims(cache, position);
+    }
+
+    /* Update variable's starting step, which is always 0 */
+    variable.m_StepsStart = 0;
+
+    // update variable Engine for read streaming functions
+    variable.m_Engine = &engine;
+}
+
 template <class T>
 void BP4Deserializer::DefineAttributeInEngineIO(
     const ElementIndexHeader &header, core::Engine &engine,
@@ -14,6 +14,7 @@
 #include "BP4Serializer.tcc"
 
 #include <chrono>
+#include <cstring> //std::memset
 #include <future>
 #include <string>
 #include <tuple>
@@ -102,7 +103,7 @@ void BP4Serializer::MakeHeader(BufferSTL &b, const std::string fileType,
     lf_CopyVersionChar(patchVersion, buffer, position);
     ++position;
 
-    // Note: Reader does process and use bytes 36-38 in
+    // Note: Reader does process and use bytes 36-39 in
     // BP4Deserialize.cpp::ParseMetadataIndex().
     // Order and position must match there.
 
@@ -136,8 +137,15 @@ void BP4Serializer::MakeHeader(BufferSTL &b, const std::string fileType,
     const uint8_t activeFlag = (isActive ? 1 : 0);
     helper::CopyToBuffer(buffer, position, &activeFlag);
 
-    // byte 39: unused
-    position += 1;
+    // byte 39: Striped data flag (used in Index Table only)
+    if (position != m_StripedFlagPosition)
+    {
+        throw std::runtime_error(
+            "ADIOS Coding ERROR in BP4Serializer::MakeHeader. Striped Flag "
+            "position mismatch");
+    }
+    const uint8_t stripedFlag = (m_StripedData ? 1 : 0);
+    helper::CopyToBuffer(buffer, position, &stripedFlag);
 
     // byte 40-63: unused
     position += 24;
@@ -253,7 +261,7 @@ size_t BP4Serializer::CloseData(core::IO &io)
             m_Profiler.m_Bytes.at("buffering") = m_Data.m_AbsolutePosition;
         }
 
-        m_Aggregator.Close();
+        m_Aggregator->Close();
         m_IsClosed = true;
     }
 
@@ -280,6 +288,35 @@ size_t BP4Serializer::CloseStream(core::IO &io, const bool addMetadata)
     return dataEndsAt;
 }
 
+size_t BP4Serializer::GetZeroCopyPayloadsSize(const size_t position) const
+    noexcept
+{
+    size_t size = 0;
+    for (const ZeroCopyPayload &payload : m_ZeroCopyPayloads)
+    {
+        if (payload.BufferPosition >= position)
+        {
+            size += payload.Size;
+        }
+    }
+    return size;
+}
+
+size_t BP4Serializer::PadData(const size_t alignment)
+{
+    const size_t size = m_Data.m_Position + GetZeroCopyPayloadsSize(0);
+    const size_t padding = (alignment - size % alignment) % alignment;
+    if (padding > 0)
+    {
+        m_Data.Resize(m_Data.m_Position + padding,
+                      " when padding data for aligned writes");
+        std::memset(m_Data.Data() + m_Data.m_Position, 0, padding);
+        m_Data.m_Position += padding;
+        m_Data.m_AbsolutePosition += padding;
+    }
+    return m_Data.m_Position;
+}
+
 /* Reset the local metadata indices */
 void BP4Serializer::ResetAllIndices()
 {
@@ -363,7 +400,8 @@ void BP4Serializer::SerializeDataBuffer(core::IO &io) noexcept
     // Note: m_MetadataSet.DataPGVarsCount has been incremented by 4
     // in previous CopyToBuffer operation!
     const uint64_t varsLength =
-        position - m_MetadataSet.DataPGVarsCountPosition - 8;
+        position - m_MetadataSet.DataPGVarsCountPosition - 8 +
+        GetZeroCopyPayloadsSize(m_MetadataSet.DataPGVarsCountPosition);
     helper::CopyToBuffer(buffer, m_MetadataSet.DataPGVarsCountPosition,
                          &varsLength);
 
@@ -392,7 +430,9 @@ void BP4Serializer::SerializeDataBuffer(core::IO &io) noexcept
 
     // Finish writing pg group length INCLUDING the record itself and
     // including the closing padding but NOT the opening [PGI
-    const uint64_t dataPGLength = position - m_MetadataSet.DataPGLengthPosition;
+    const uint64_t dataPGLength =
+        position - m_MetadataSet.DataPGLengthPosition +
+        GetZeroCopyPayloadsSize(m_MetadataSet.DataPGLengthPosition);
     helper::CopyToBuffer(buffer, m_MetadataSet.DataPGLengthPosition,
                          &dataPGLength);
 
@@ -1139,7 +1179,11 @@ ADIOS2_FOREACH_ATTRIBUTE_STDTYPE_1ARG(declare_template_instantiation)
 #define declare_template_instantiation(T)                                      \
     template void BP4Serializer::PutVariablePayload(                           \
         const core::Variable<T> &, const typename core::Variable<T>::Info &,   \
-        const bool, typename core::Variable<T>::Span *) noexcept;              \
+        const bool, typename core::Variable<T>::Span *, const bool) noexcept;  \
+                                                                               \
+    template bool BP4Serializer::IsZeroCopyPayload(                            \
+        const core::Variable<T> &, const typename core::Variable<T>::Info &)   \
+        const noexcept;                                                        \
                                                                                \
     template void BP4Serializer::PutVariableMetadata(                          \
         const core::Variable<T> &, const typename core::Variable<T>::Info &,   \
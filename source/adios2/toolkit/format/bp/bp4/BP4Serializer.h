@@ -75,13 +75,63 @@ public:
     /**
      * Put in buffer variable payload. Expensive part.
      * @param variable payload input from m_PutValues
+     * @param zeroCopy true: payload is not copied, it is recorded in
+     * m_ZeroCopyPayloads to be written from user memory
      */
     template <class T>
     void PutVariablePayload(
         const core::Variable<T> &variable,
         const typename core::Variable<T>::Info &blockInfo,
         const bool sourceRowMajor = true,
-        typename core::Variable<T>::Span *span = nullptr) noexcept;
+        typename core::Variable<T>::Span *span = nullptr,
+        const bool zeroCopy = false) noexcept;
+
+    /** Payload of a deferred Put written from user memory */
+    struct ZeroCopyPayload
+    {
+        /** position in m_Data where the payload belongs in the file */
+        size_t BufferPosition;
+        const char *Data;
+        size_t Size;
+    };
+
+    /** payloads not copied into m_Data, in buffer order, must be written
+     * and cleared by the engine with the next data buffer */
+    std::vector<ZeroCopyPayload> m_ZeroCopyPayloads;
+
+    /** sum of deferred payloads that are candidates for zero-copy,
+     * not included in m_DeferredVariablesDataSize */
+    size_t m_DeferredZeroCopyDataSize = 0;
+
+    /**
+     * Checks if a block payload can be written from user memory,
+     * see ZeroCopyThreshold parameter
+     * @param variable
+     * @param blockInfo
+     * @return true: contiguous, not operated payload above the threshold,
+     * false: payload must be copied into m_Data
+     */
+    template <class T>
+    bool IsZeroCopyPayload(
+        const core::Variable<T> &variable,
+        const typename core::Variable<T>::Info &blockInfo) const noexcept;
+
+    /**
+     * Size of zero-copy payloads placed from a position in m_Data
+     * @param position in m_Data
+     * @return sum of payload sizes at or after position
+     */
+    size_t GetZeroCopyPayloadsSize(const size_t position = 0) const noexcept;
+
+    /**
+     * Pads the closed data buffer with zeros so that the bytes written by
+     * this rank in the current flush, zero-copy payloads included, are a
+     * multiple of alignment. Blocks are located through metadata, the
+     * padding is never read.
+     * @param alignment in bytes
+     * @return data buffer position after padding
+     */
+    size_t PadData(const size_t alignment);
 
     template <class T>
     void PutSpanMetadata(const core::Variable<T> &variable,
@@ -259,7 +309,11 @@ private:
 #define declare_template_instantiation(T)                                      \
     extern template void BP4Serializer::PutVariablePayload(                    \
         const core::Variable<T> &, const typename core::Variable<T>::Info &,   \
-        const bool, typename core::Variable<T>::Span *) noexcept;              \
+        const bool, typename core::Variable<T>::Span *, const bool) noexcept;  \
+                                                                               \
+    extern template bool BP4Serializer::IsZeroCopyPayload(                     \
+        const core::Variable<T> &, const typename core::Variable<T>::Info &)   \
+        const noexcept;                                                        \
                                                                                \
     extern template void BP4Serializer::PutVariableMetadata(                   \
         const core::Variable<T> &, const typename core::Variable<T>::Info &,   \
@@ -37,7 +37,7 @@ inline void BP4Serializer::PutVariableMetadata(
     const bool sourceRowMajor, typename core::Variable<T>::Span *span) noexcept
 {
     auto lf_SetOffset = [&](uint64_t &offset) {
-        if (m_Aggregator.m_IsActive && !m_Aggregator.m_IsConsumer)
+        if (m_Aggregator->m_IsActive && !m_Aggregator->m_IsConsumer)
         {
             offset = static_cast<uint64_t>(m_Data.m_Position);
         }
@@ -82,7 +82,8 @@ template <class T>
 inline void BP4Serializer::PutVariablePayload(
     const core::Variable<T> &variable,
     const typename core::Variable<T>::Info &blockInfo,
-    const bool sourceRowMajor, typename core::Variable<T>::Span *span) noexcept
+    const bool sourceRowMajor, typename core::Variable<T>::Span *span,
+    const bool zeroCopy) noexcept
 {
     m_Profiler.Start("buffering");
     if (span != nullptr)
@@ -111,7 +112,17 @@ inline void BP4Serializer::PutVariablePayload(
         return;
     }
 
-    if (blockInfo.Operations.empty())
+    if (zeroCopy)
+    {
+        // payload is written from user memory at m_Data.m_Position
+        const size_t payloadSize =
+            helper::GetTotalSize(blockInfo.Count) * sizeof(T);
+        m_ZeroCopyPayloads.push_back(
+            {m_Data.m_Position, reinterpret_cast<const char *>(blockInfo.Data),
+             payloadSize});
+        m_Data.m_AbsolutePosition += payloadSize;
+    }
+    else if (blockInfo.Operations.empty())
     {
         PutPayloadInBuffer(variable, blockInfo, sourceRowMajor);
     }
@@ -123,14 +134,35 @@ inline void BP4Serializer::PutVariablePayload(
     /* Now we can update the varLength including payload size including the
      * closing padding but NOT the opening [VMD
      */
-    const uint64_t varLength =
-        static_cast<uint64_t>(m_Data.m_Position - m_LastVarLengthPosInBuffer);
+    const uint64_t varLength = static_cast<uint64_t>(
+        m_Data.m_Position - m_LastVarLengthPosInBuffer +
+        GetZeroCopyPayloadsSize(m_LastVarLengthPosInBuffer));
     size_t backPosition = m_LastVarLengthPosInBuffer;
     helper::CopyToBuffer(m_Data.m_Buffer, backPosition, &varLength);
 
     m_Profiler.Stop("buffering");
 }
 
+template <class T>
+bool BP4Serializer::IsZeroCopyPayload(
+    const core::Variable<T> &variable,
+    const typename core::Variable<T>::Info &blockInfo) const noexcept
+{
+    // aggregated non-consumers send m_Data to their consumer, async writes
+    // outlive the user memory
+    if (variable.m_SingleValue || !blockInfo.Operations.empty() ||
+        !blockInfo.MemoryStart.empty() || m_Parameters.AsyncWrite ||
+        (m_Aggregator->m_IsActive && !m_Aggregator->m_IsConsumer))
+    {
+        return false;
+    }
+
+    // zero blocks have nothing to write
+    const size_t payloadSize =
+        helper::GetTotalSize(blockInfo.Count) * sizeof(T);
+    return payloadSize > 0 && payloadSize >= m_Parameters.ZeroCopyThreshold;
+}
+
 template <class T>
 void BP4Serializer::PutSpanMetadata(
     const core::Variable<T> &variable,
@@ -552,8 +584,17 @@ void BP4Serializer::PutVariableMetadataInIndex(
         index.Count = 1;
         helper::InsertToBuffer(buffer, &index.Count);
 
-        // For updating absolute offsets in agreggation
-        index.LastUpdatedPosition = buffer.size();
+        // For updating absolute offsets in agreggation, characteristics of
+        // previous steps in the same flush may not be updated yet
+        if (index.LastUpdatedPosition < index.CurrentHeaderPosition)
+        {
+            index.StepHeaders.emplace_back(index.CurrentHeaderPosition,
+                                           buffer.size());
+        }
+        else
+        {
+            index.LastUpdatedPosition = buffer.size();
+        }
 
         PutVariableCharacteristics(variable, blockInfo, stats, buffer, span);
         const uint32_t indexLength =
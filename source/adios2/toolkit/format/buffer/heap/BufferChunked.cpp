@@ -0,0 +1,189 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BufferChunked.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "BufferChunked.h"
+
+#include <algorithm> // std::min, std::max
+#include <cstdlib>   // std::malloc, std::free
+#include <cstring>   // std::memcpy, std::memset
+#include <stdexcept> // std::runtime_error
+
+#ifdef __linux__
+#include <sys/mman.h> // madvise
+#endif
+
+namespace adios2
+{
+namespace format
+{
+
+namespace
+{
+#ifdef __linux__
+/** transparent huge page size on x86_64 and most aarch64 kernels */
+constexpr size_t HugePageSize = 2 * 1024 * 1024;
+#endif
+} // end anonymous namespace
+
+BufferChunked::BufferChunked(const size_t chunkSize, const bool hugePages)
+: Buffer("BufferChunked"), m_ChunkSize(std::max(chunkSize, size_t(1))),
+  m_HugePages(hugePages)
+{
+}
+
+BufferChunked::~BufferChunked() { Delete(); }
+
+void BufferChunked::Resize(const size_t size, const std::string hint)
+{
+    if (size > m_Capacity)
+    {
+        try
+        {
+            AddChunk(std::max(m_ChunkSize, size - m_Capacity));
+        }
+        catch (...)
+        {
+            std::throw_with_nested(std::runtime_error(
+                "ERROR: buffer overflow when resizing to " +
+                std::to_string(size) + " bytes, " + hint + "\n"));
+        }
+    }
+}
+
+void BufferChunked::Reset(const bool resetAbsolutePosition,
+                          const bool zeroInitialize)
+{
+    m_Position = 0;
+    m_CurrentChunk = 0;
+    m_ChunkPosition = 0;
+    if (resetAbsolutePosition)
+    {
+        m_AbsolutePosition = 0;
+    }
+    if (zeroInitialize)
+    {
+        for (Chunk &chunk : m_Chunks)
+        {
+            std::memset(chunk.Data, 0, chunk.Size);
+        }
+    }
+}
+
+size_t BufferChunked::GetAvailableSize() const
+{
+    return m_Capacity - m_Position;
+}
+
+void BufferChunked::Delete()
+{
+    for (Chunk &chunk : m_Chunks)
+    {
+        std::free(chunk.Data);
+    }
+    m_Chunks.clear();
+    m_Capacity = 0;
+    m_Position = 0;
+    m_CurrentChunk = 0;
+    m_ChunkPosition = 0;
+}
+
+void BufferChunked::Append(const char *data, const size_t size)
+{
+    size_t remaining = size;
+    while (remaining > 0)
+    {
+        if (m_CurrentChunk < m_Chunks.size() &&
+            m_ChunkPosition == m_Chunks[m_CurrentChunk].Size)
+        {
+            ++m_CurrentChunk;
+            m_ChunkPosition = 0;
+        }
+
+        if (m_CurrentChunk == m_Chunks.size())
+        {
+            // a single chunk for the rest of a large append
+            AddChunk(std::max(m_ChunkSize, remaining));
+        }
+
+        Chunk &chunk = m_Chunks[m_CurrentChunk];
+        const size_t bytes = std::min(remaining, chunk.Size - m_ChunkPosition);
+        std::memcpy(chunk.Data + m_ChunkPosition, data, bytes);
+
+        data += bytes;
+        remaining -= bytes;
+        m_ChunkPosition += bytes;
+    }
+
+    m_Position += size;
+    m_AbsolutePosition += size;
+}
+
+std::vector<BufferChunked::Chunk> BufferChunked::GetChunks() const
+{
+    std::vector<Chunk> chunks;
+    if (m_Position == 0)
+    {
+        return chunks;
+    }
+
+    // chunks before the current one are full
+    chunks.reserve(m_CurrentChunk + 1);
+    for (size_t i = 0; i < m_CurrentChunk; ++i)
+    {
+        chunks.push_back(m_Chunks[i]);
+    }
+
+    if (m_ChunkPosition > 0)
+    {
+        chunks.push_back({m_Chunks[m_CurrentChunk].Data, m_ChunkPosition});
+    }
+    return chunks;
+}
+
+// PRIVATE
+void BufferChunked::AddChunk(const size_t size)
+{
+    void *data = nullptr;
+    size_t chunkSize = size;
+
+#ifdef __linux__
+    if (m_HugePages)
+    {
+        chunkSize = (size + HugePageSize - 1) / HugePageSize * HugePageSize;
+        if (posix_memalign(&data, HugePageSize, chunkSize) != 0)
+        {
+            data = nullptr;
+        }
+#ifdef MADV_HUGEPAGE
+        else
+        {
+            // only advice, the kernel falls back to regular pages
+            madvise(data, chunkSize, MADV_HUGEPAGE);
+        }
+#endif
+    }
+    else
+    {
+        data = std::malloc(chunkSize);
+    }
+#else
+    data = std::malloc(chunkSize);
+#endif
+
+    if (data == nullptr)
+    {
+        throw std::runtime_error("ERROR: couldn't allocate buffer chunk of " +
+                                 std::to_string(chunkSize) + " bytes\n");
+    }
+
+    m_Chunks.push_back({static_cast<char *>(data), chunkSize});
+    m_Capacity += chunkSize;
+}
+
+} // end namespace format
+} // end namespace adios2
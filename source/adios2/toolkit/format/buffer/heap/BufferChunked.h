@@ -0,0 +1,95 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BufferChunked.h buffer made of a list of fixed-size chunks, grows without
+ * reallocating or copying existing contents
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BUFFER_HEAP_BUFFERCHUNKED_H_
+#define ADIOS2_TOOLKIT_FORMAT_BUFFER_HEAP_BUFFERCHUNKED_H_
+
+#include "adios2/toolkit/format/buffer/Buffer.h"
+
+#include <vector>
+
+namespace adios2
+{
+namespace format
+{
+
+class BufferChunked : public Buffer
+{
+public:
+    /** contiguous memory segment of the buffer */
+    struct Chunk
+    {
+        char *Data;
+        size_t Size;
+    };
+
+    /**
+     * @param chunkSize size of new chunks, larger appends get a single chunk
+     * for the bytes that don't fit in the current one
+     * @param hugePages true: chunks are aligned and advised to be backed by
+     * transparent huge pages (Linux only, ignored elsewhere)
+     */
+    BufferChunked(const size_t chunkSize, const bool hugePages = false);
+
+    ~BufferChunked();
+
+    BufferChunked(const BufferChunked &) = delete;
+    BufferChunked &operator=(const BufferChunked &) = delete;
+
+    /** Reserves chunks until capacity is at least size, contents are kept */
+    void Resize(const size_t size, const std::string hint) final;
+
+    /** Keeps allocated chunks for reuse */
+    void Reset(const bool resetAbsolutePosition,
+               const bool zeroInitialize) final;
+
+    size_t GetAvailableSize() const final;
+
+    /** Frees all chunks */
+    void Delete() final;
+
+    /**
+     * Copies size bytes at the end of the buffer, allocating new chunks when
+     * needed. Existing contents are never moved.
+     * @param data input
+     * @param size bytes to copy from data
+     */
+    void Append(const char *data, const size_t size);
+
+    /**
+     * Segments holding the buffer contents [0, m_Position) in order, ready
+     * for vectored I/O
+     * @return used part of each chunk, unused chunks are not included
+     */
+    std::vector<Chunk> GetChunks() const;
+
+private:
+    const size_t m_ChunkSize;
+    const bool m_HugePages;
+
+    /** allocated chunks, Size is the chunk capacity */
+    std::vector<Chunk> m_Chunks;
+
+    /** chunk in m_Chunks receiving the next Append */
+    size_t m_CurrentChunk = 0;
+
+    /** bytes used in m_Chunks[m_CurrentChunk] */
+    size_t m_ChunkPosition = 0;
+
+    /** sum of all chunk capacities */
+    size_t m_Capacity = 0;
+
+    void AddChunk(const size_t size);
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BUFFER_HEAP_BUFFERCHUNKED_H_ */
@@ -38,14 +38,27 @@ BufferSystemV::BufferSystemV(const size_t fixedSize, const std::string &name,
             std::to_string(fixedSize) + " with shmget \n");
     }
 
-    void *data = shmat(m_ShmID, nullptr, 0);
-    int *status = reinterpret_cast<int *>(data);
-    if (*status == -1)
+    Attach();
+}
+
+BufferSystemV::BufferSystemV(const size_t fixedSize)
+: Buffer("BufferSystemV", fixedSize), m_Remove(true)
+{
+    m_ShmID = shmget(IPC_PRIVATE, static_cast<unsigned long int>(fixedSize),
+                     IPC_CREAT | 0600);
+    if (m_ShmID == -1)
     {
-        throw std::runtime_error("ERROR: could not attach shared memory buffer "
-                                 "to address with shmat\n");
+        throw std::ios_base::failure(
+            "ERROR: could not create shared memory buffer of size " +
+            std::to_string(fixedSize) + " with shmget \n");
     }
-    m_Data = static_cast<char *>(data);
+    Attach();
+}
+
+BufferSystemV::BufferSystemV(const int shmID, const size_t fixedSize)
+: Buffer("BufferSystemV", fixedSize), m_ShmID(shmID), m_Remove(false)
+{
+    Attach();
 }
 
 BufferSystemV::~BufferSystemV()
@@ -58,6 +71,8 @@ BufferSystemV::~BufferSystemV()
     }
 }
 
+int BufferSystemV::GetShmID() const noexcept { return m_ShmID; }
+
 char *BufferSystemV::Data() noexcept { return m_Data; }
 
 const char *BufferSystemV::Data() const noexcept { return m_Data; }
@@ -76,5 +91,21 @@ void BufferSystemV::Reset(const bool resetAbsolutePosition,
     }
 }
 
+// PRIVATE
+void BufferSystemV::Attach()
+{
+    void *data = shmat(m_ShmID, nullptr, 0);
+    if (data == reinterpret_cast<void *>(-1))
+    {
+        if (m_Remove)
+        {
+            shmctl(m_ShmID, IPC_RMID, NULL);
+        }
+        throw std::runtime_error("ERROR: could not attach shared memory buffer "
+                                 "to address with shmat\n");
+    }
+    m_Data = static_cast<char *>(data);
+}
+
 } // end namespace format
 } // end namespace adios2
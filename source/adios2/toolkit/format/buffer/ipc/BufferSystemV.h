@@ -24,8 +24,29 @@ public:
     BufferSystemV(const size_t fixedSize, const std::string &name,
                   const unsigned int projectID, const bool remove);
 
+    /**
+     * Creates a private segment, other processes on the same node attach to
+     * it with GetShmID. Removed with the destructor once all detach.
+     * @param fixedSize segment size
+     */
+    explicit BufferSystemV(const size_t fixedSize);
+
+    /**
+     * Attaches to a segment created by another process, it is not removed
+     * with the destructor
+     * @param shmID from GetShmID in the creating process
+     * @param fixedSize segment size
+     */
+    BufferSystemV(const int shmID, const size_t fixedSize);
+
     ~BufferSystemV();
 
+    BufferSystemV(const BufferSystemV &) = delete;
+    BufferSystemV &operator=(const BufferSystemV &) = delete;
+
+    /** @return shared memory segment ID to attach from other processes */
+    int GetShmID() const noexcept;
+
     char *Data() noexcept final;
 
     const char *Data() const noexcept final;
@@ -42,6 +63,9 @@ private:
 
     /** false: make it persistent, true: remove with destructor */
     const bool m_Remove;
+
+    /** attaches m_ShmID to m_Data */
+    void Attach();
 };
 
 } // end namespace format
@@ -27,11 +27,35 @@ void Transport::IWrite(const char *buffer, size_t size, Status &status,
     throw std::invalid_argument("ERROR: this class doesn't implement IWrite\n");
 }
 
+void Transport::WriteV(const std::vector<IOVec> &iov, size_t start)
+{
+    for (const IOVec &segment : iov)
+    {
+        Write(segment.Data, segment.Size, start);
+        if (start != MaxSizeT)
+        {
+            start += segment.Size;
+        }
+    }
+}
+
 void Transport::IRead(char *buffer, size_t size, Status &status, size_t start)
 {
     throw std::invalid_argument("ERROR: this class doesn't implement IRead\n");
 }
 
+void Transport::Wait(Status & /*status*/)
+{
+    throw std::invalid_argument("ERROR: this class doesn't implement Wait\n");
+}
+
+bool Transport::IsAsync() const noexcept { return false; }
+
+const char *Transport::MappedData(size_t /*size*/, size_t /*start*/)
+{
+    return nullptr;
+}
+
 void Transport::InitProfiler(const Mode openMode, const TimeUnit timeUnit)
 {
     m_Profiler.m_IsActive = true;
@@ -44,6 +44,13 @@ public:
         // TODO add more thing...time?
     };
 
+    /** Memory segment of a gathered write, same as POSIX struct iovec */
+    struct IOVec
+    {
+        const char *Data;
+        size_t Size;
+    };
+
     /**
      * Base constructor that all derived classes pass
      * @param type from derived class
@@ -93,6 +100,15 @@ public:
     virtual void IWrite(const char *buffer, size_t size, Status &status,
                         size_t start = MaxSizeT);
 
+    /**
+     * Writes memory segments one after the other as a single contiguous
+     * write. Default calls Write for each segment.
+     * @param iov segments to be written, in order
+     * @param start starting position for writing (to allow rewind), if not
+     * passed then start at current stream position
+     */
+    virtual void WriteV(const std::vector<IOVec> &iov, size_t start = MaxSizeT);
+
     /**
      * Reads from transport "size" bytes from a certain position. Note that size
      * and position and non-const due to the nature of underlying transport
@@ -108,6 +124,28 @@ public:
     virtual void IRead(char *buffer, size_t size, Status &status,
                        size_t start = MaxSizeT);
 
+    /**
+     * Blocks until the IWrite or IRead calls sharing status complete
+     * @param status passed to IWrite or IRead
+     */
+    virtual void Wait(Status &status);
+
+    /**
+     * @return true if IWrite, IRead and Wait are implemented, false by
+     * default
+     */
+    virtual bool IsAsync() const noexcept;
+
+    /**
+     * Gives direct access to "size" bytes of the transport contents starting
+     * at a certain position, without copying. Only memory mapped transports
+     * support it.
+     * @param size number of bytes to be accessed
+     * @param start starting position
+     * @return pointer to the contents, nullptr if not supported
+     */
+    virtual const char *MappedData(size_t size, size_t start);
+
     /**
      * Returns the size of current data in transport
      * @return size as size_t
@@ -0,0 +1,765 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileAIO.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "FileAIO.h"
+
+#include "adios2/helper/adiosFunctions.h"
+
+#include <algorithm>     // std::min
+#include <aio.h>         // lio_listio, aio_suspend, aio_error, aio_return
+#include <cstdint>       // uint64_t
+#include <cstdio>        // remove
+#include <cstring>       // strerror, std::memset
+#include <errno.h>       // errno
+#include <fcntl.h>       // open
+#include <stdexcept>     // std::runtime_error
+#include <sys/stat.h>    // fstat
+#include <sys/types.h>   // off_t
+#include <unistd.h>      // close, sysconf
+#include <unordered_map> // AIOQueue::m_Pending
+
+#ifdef ADIOS2_AIO_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>    // mmap
+#include <sys/syscall.h> // __NR_io_uring_setup, __NR_io_uring_enter
+#include <sys/uio.h>     // struct iovec
+#endif
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+/** read or write of at most DefaultMaxFileBatchSize bytes */
+struct AIORequest
+{
+    char *Data;
+    size_t Size;
+    size_t Offset;
+    bool IsWrite;
+    Transport::Status *RequestStatus;
+};
+
+/**
+ * Fixed number of request slots shared by the io_uring and POSIX AIO
+ * backends. A status may be shared by several requests, it is Running until
+ * all of them complete. Partial reads and writes are requested again for the
+ * remaining bytes.
+ */
+class AIOQueue
+{
+public:
+    AIOQueue(const int fileDescriptor, const size_t depth)
+    : m_FileDescriptor(fileDescriptor), m_Requests(depth)
+    {
+        m_FreeSlots.reserve(depth);
+        for (size_t slot = depth; slot > 0; --slot)
+        {
+            m_FreeSlots.push_back(slot - 1);
+        }
+    }
+
+    virtual ~AIOQueue() = default;
+
+    /** errno of the last failed request, 0 for a read past the end */
+    int m_Error = 0;
+
+    bool IsPending(const Transport::Status &status) const
+    {
+        return m_Pending.count(const_cast<Transport::Status *>(&status)) > 0;
+    }
+
+    /** Prepares a request, waits for a free slot if all are in use */
+    void Push(const AIORequest &request)
+    {
+        while (m_FreeSlots.empty())
+        {
+            Submit();
+            Reap();
+        }
+
+        Transport::Status &status = *request.RequestStatus;
+        size_t &pending = m_Pending[&status];
+        if (pending == 0)
+        {
+            status.Bytes = 0;
+            status.Running = true;
+            status.Successful = true;
+        }
+        ++pending;
+
+        const size_t slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        m_Requests[slot] = request;
+        Prepare(slot);
+    }
+
+    /** Submits all prepared requests */
+    virtual void Submit() = 0;
+
+    /** Submits prepared requests and waits until status completes */
+    void Wait(Transport::Status &status)
+    {
+        Submit();
+        while (status.Running && IsPending(status))
+        {
+            Reap();
+        }
+    }
+
+    /** Submits prepared requests and waits until all complete */
+    void WaitAll()
+    {
+        Submit();
+        while (m_FreeSlots.size() < m_Requests.size())
+        {
+            Reap();
+        }
+    }
+
+protected:
+    const int m_FileDescriptor;
+
+    /** request of each slot */
+    std::vector<AIORequest> m_Requests;
+
+    /** Adds the request in slot to the next submission */
+    virtual void Prepare(const size_t slot) = 0;
+
+    /**
+     * Waits for at least one request in flight to finish
+     * @param completions slot and result of finished requests, bytes or
+     * -errno
+     */
+    virtual void
+    Complete(std::vector<std::pair<size_t, int64_t>> &completions) = 0;
+
+private:
+    std::vector<size_t> m_FreeSlots;
+    std::unordered_map<Transport::Status *, size_t> m_Pending;
+    std::vector<std::pair<size_t, int64_t>> m_Completions;
+
+    void Reap()
+    {
+        m_Completions.clear();
+        Complete(m_Completions);
+
+        bool resubmit = false;
+        for (const auto &completion : m_Completions)
+        {
+            const size_t slot = completion.first;
+            const int64_t result = completion.second;
+            AIORequest &request = m_Requests[slot];
+            Transport::Status &status = *request.RequestStatus;
+
+            if (result == -EINTR || result == -EAGAIN)
+            {
+                Prepare(slot);
+                resubmit = true;
+                continue;
+            }
+
+            if (result > 0 && static_cast<size_t>(result) < request.Size)
+            {
+                const size_t bytes = static_cast<size_t>(result);
+                request.Data += bytes;
+                request.Size -= bytes;
+                request.Offset += bytes;
+                status.Bytes += bytes;
+                Prepare(slot);
+                resubmit = true;
+                continue;
+            }
+
+            if (result <= 0)
+            {
+                // zero bytes: read past the end of file
+                m_Error = static_cast<int>(-result);
+                status.Successful = false;
+            }
+            else
+            {
+                status.Bytes += static_cast<size_t>(result);
+            }
+
+            m_FreeSlots.push_back(slot);
+            auto itPending = m_Pending.find(&status);
+            if (--itPending->second == 0)
+            {
+                status.Running = false;
+                m_Pending.erase(itPending);
+            }
+        }
+
+        if (resubmit)
+        {
+            Submit();
+        }
+    }
+};
+
+namespace
+{
+
+std::string ErrnoMessage(const int error)
+{
+    return ": errno = " + std::to_string(error) + ": " + strerror(error);
+}
+
+/** POSIX AIO, requests are submitted with lio_listio */
+class POSIXQueue : public AIOQueue
+{
+public:
+    POSIXQueue(const int fileDescriptor, const size_t depth)
+    : AIOQueue(fileDescriptor, depth), m_Blocks(depth)
+    {
+        const long listMax = sysconf(_SC_AIO_LISTIO_MAX);
+        m_ListMax = listMax > 0 ? static_cast<size_t>(listMax) : depth;
+    }
+
+    void Submit() final
+    {
+        size_t first = 0;
+        while (first < m_Prepared.size())
+        {
+            const size_t count =
+                std::min(m_Prepared.size() - first, m_ListMax);
+            errno = 0;
+            if (lio_listio(LIO_NOWAIT, &m_Prepared[first],
+                           static_cast<int>(count), nullptr) == -1)
+            {
+                const int error = errno;
+                m_Prepared.clear();
+                throw std::ios_base::failure(
+                    "ERROR: couldn't submit file requests, in call to POSIX "
+                    "AIO lio_listio" +
+                    ErrnoMessage(error));
+            }
+
+            for (size_t i = first; i < first + count; ++i)
+            {
+                m_InFlight.push_back(
+                    static_cast<size_t>(m_Prepared[i] - m_Blocks.data()));
+            }
+            first += count;
+        }
+        m_Prepared.clear();
+    }
+
+private:
+    /** control block of each slot */
+    std::vector<struct aiocb> m_Blocks;
+    std::vector<struct aiocb *> m_Prepared;
+    std::vector<size_t> m_InFlight;
+    std::vector<const struct aiocb *> m_Suspend;
+    size_t m_ListMax;
+
+    void Prepare(const size_t slot) final
+    {
+        const AIORequest &request = m_Requests[slot];
+        struct aiocb &block = m_Blocks[slot];
+        std::memset(&block, 0, sizeof(block));
+        block.aio_fildes = m_FileDescriptor;
+        block.aio_buf = request.Data;
+        block.aio_nbytes = request.Size;
+        block.aio_offset = static_cast<off_t>(request.Offset);
+        block.aio_lio_opcode = request.IsWrite ? LIO_WRITE : LIO_READ;
+        block.aio_sigevent.sigev_notify = SIGEV_NONE;
+        m_Prepared.push_back(&block);
+    }
+
+    void Complete(std::vector<std::pair<size_t, int64_t>> &completions) final
+    {
+        if (m_InFlight.empty())
+        {
+            return;
+        }
+
+        m_Suspend.clear();
+        for (const size_t slot : m_InFlight)
+        {
+            m_Suspend.push_back(&m_Blocks[slot]);
+        }
+
+        // returns at once if a request already finished
+        while (aio_suspend(m_Suspend.data(), static_cast<int>(m_Suspend.size()),
+                           nullptr) == -1)
+        {
+            if (errno != EINTR && errno != EAGAIN)
+            {
+                throw std::ios_base::failure(
+                    "ERROR: couldn't wait for file requests, in call to "
+                    "POSIX AIO aio_suspend" +
+                    ErrnoMessage(errno));
+            }
+        }
+
+        size_t i = 0;
+        while (i < m_InFlight.size())
+        {
+            struct aiocb &block = m_Blocks[m_InFlight[i]];
+            const int error = aio_error(&block);
+            if (error == EINPROGRESS)
+            {
+                ++i;
+                continue;
+            }
+
+            const ssize_t result = aio_return(&block);
+            completions.emplace_back(m_InFlight[i],
+                                     error == 0 ? result : -error);
+            m_InFlight[i] = m_InFlight.back();
+            m_InFlight.pop_back();
+        }
+    }
+};
+
+#ifdef ADIOS2_AIO_HAVE_IO_URING
+/** io_uring through system calls, one readv/writev entry per request */
+class URingQueue : public AIOQueue
+{
+public:
+    URingQueue(const int fileDescriptor, const size_t depth)
+    : AIOQueue(fileDescriptor, depth), m_IOVecs(depth)
+    {
+        struct io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        m_Ring = static_cast<int>(syscall(
+            __NR_io_uring_setup, static_cast<unsigned>(depth), &params));
+        if (m_Ring == -1)
+        {
+            throw std::runtime_error("ERROR: io_uring_setup failed" +
+                                     ErrnoMessage(errno));
+        }
+
+        m_SQRingSize =
+            params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_CQRingSize = params.cq_off.cqes +
+                       params.cq_entries * sizeof(struct io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+        const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP);
+#else
+        const bool singleMmap = false;
+#endif
+        if (singleMmap)
+        {
+            m_SQRingSize = std::max(m_SQRingSize, m_CQRingSize);
+            m_CQRingSize = m_SQRingSize;
+        }
+
+        m_SQRing = Map(m_SQRingSize, IORING_OFF_SQ_RING);
+        m_CQRing =
+            singleMmap ? m_SQRing : Map(m_CQRingSize, IORING_OFF_CQ_RING);
+        m_SQEsSize = params.sq_entries * sizeof(struct io_uring_sqe);
+        m_SQEs = static_cast<struct io_uring_sqe *>(
+            Map(m_SQEsSize, IORING_OFF_SQES));
+
+        char *sq = static_cast<char *>(m_SQRing);
+        m_SQTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        m_SQMask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        m_SQArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+
+        char *cq = static_cast<char *>(m_CQRing);
+        m_CQHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        m_CQTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        m_CQMask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        m_CQEs = reinterpret_cast<struct io_uring_cqe *>(cq +
+                                                         params.cq_off.cqes);
+    }
+
+    ~URingQueue() { Release(); }
+
+    void Submit() final
+    {
+        while (m_Prepared > 0)
+        {
+            const int submitted = Enter(m_Prepared, 0, 0);
+            if (submitted == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::ios_base::failure(
+                    "ERROR: couldn't submit file requests, in call to "
+                    "io_uring_enter" +
+                    ErrnoMessage(errno));
+            }
+            m_Prepared -= static_cast<unsigned>(submitted);
+        }
+    }
+
+private:
+    int m_Ring = -1;
+    void *m_SQRing = MAP_FAILED;
+    void *m_CQRing = MAP_FAILED;
+    size_t m_SQRingSize = 0;
+    size_t m_CQRingSize = 0;
+    size_t m_SQEsSize = 0;
+    struct io_uring_sqe *m_SQEs = nullptr;
+    unsigned *m_SQTail = nullptr;
+    unsigned *m_SQArray = nullptr;
+    unsigned m_SQMask = 0;
+    unsigned *m_CQHead = nullptr;
+    unsigned *m_CQTail = nullptr;
+    unsigned m_CQMask = 0;
+    struct io_uring_cqe *m_CQEs = nullptr;
+
+    /** segment of each slot, must live until the request completes */
+    std::vector<struct iovec> m_IOVecs;
+
+    /** entries added to the submission ring since the last Submit */
+    unsigned m_Prepared = 0;
+
+    void *Map(const size_t size, const off_t offset)
+    {
+        void *ring = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, m_Ring, offset);
+        if (ring == MAP_FAILED)
+        {
+            const int error = errno;
+            Release();
+            throw std::runtime_error("ERROR: couldn't map io_uring rings" +
+                                     ErrnoMessage(error));
+        }
+        return ring;
+    }
+
+    void Release() noexcept
+    {
+        if (m_SQEs != nullptr)
+        {
+            munmap(m_SQEs, m_SQEsSize);
+        }
+        if (m_CQRing != MAP_FAILED && m_CQRing != m_SQRing)
+        {
+            munmap(m_CQRing, m_CQRingSize);
+        }
+        if (m_SQRing != MAP_FAILED)
+        {
+            munmap(m_SQRing, m_SQRingSize);
+        }
+        if (m_Ring != -1)
+        {
+            close(m_Ring);
+        }
+    }
+
+    int Enter(const unsigned toSubmit, const unsigned minComplete,
+              const unsigned flags)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, m_Ring, toSubmit,
+                                        minComplete, flags, nullptr, 0));
+    }
+
+    void Prepare(const size_t slot) final
+    {
+        const AIORequest &request = m_Requests[slot];
+        m_IOVecs[slot].iov_base = request.Data;
+        m_IOVecs[slot].iov_len = request.Size;
+
+        // only this thread moves the tail
+        const unsigned tail = *m_SQTail;
+        const unsigned index = tail & m_SQMask;
+        struct io_uring_sqe &sqe = m_SQEs[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = request.IsWrite ? IORING_OP_WRITEV : IORING_OP_READV;
+        sqe.fd = m_FileDescriptor;
+        sqe.addr = reinterpret_cast<uint64_t>(&m_IOVecs[slot]);
+        sqe.len = 1;
+        sqe.off = request.Offset;
+        sqe.user_data = slot;
+        m_SQArray[index] = index;
+        __atomic_store_n(m_SQTail, tail + 1, __ATOMIC_RELEASE);
+        ++m_Prepared;
+    }
+
+    void Complete(std::vector<std::pair<size_t, int64_t>> &completions) final
+    {
+        unsigned head = *m_CQHead;
+        if (head == __atomic_load_n(m_CQTail, __ATOMIC_ACQUIRE))
+        {
+            while (Enter(0, 1, IORING_ENTER_GETEVENTS) == -1)
+            {
+                if (errno != EINTR)
+                {
+                    throw std::ios_base::failure(
+                        "ERROR: couldn't wait for file requests, in call to "
+                        "io_uring_enter" +
+                        ErrnoMessage(errno));
+                }
+            }
+        }
+
+        const unsigned tail = __atomic_load_n(m_CQTail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head)
+        {
+            const struct io_uring_cqe &cqe = m_CQEs[head & m_CQMask];
+            completions.emplace_back(static_cast<size_t>(cqe.user_data),
+                                     cqe.res);
+        }
+        __atomic_store_n(m_CQHead, head, __ATOMIC_RELEASE);
+    }
+};
+#endif
+
+} // end anonymous namespace
+
+FileAIO::FileAIO(helper::Comm const &comm) : Transport("File", "AIO", comm) {}
+
+FileAIO::~FileAIO()
+{
+    if (m_IsOpen)
+    {
+        try
+        {
+            // the kernel may still access the buffers of requests in flight
+            m_Queue->WaitAll();
+        }
+        catch (...)
+        {
+        }
+        close(m_FileDescriptor);
+    }
+}
+
+void FileAIO::Open(const std::string &name, const Mode openMode,
+                   const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    m_Position = 0;
+
+    ProfilerStart("open");
+    errno = 0;
+    switch (m_OpenMode)
+    {
+    case (Mode::Write):
+        m_FileDescriptor =
+            open(m_Name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        break;
+
+    case (Mode::Append):
+        m_FileDescriptor = open(m_Name.c_str(), O_RDWR | O_CREAT, 0777);
+        break;
+
+    case (Mode::Read):
+        m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+        break;
+
+    default:
+        m_FileDescriptor = -1;
+    }
+    m_Errno = errno;
+    ProfilerStop("open");
+
+    CheckFile("couldn't open file " + m_Name + ", in call to AIO open");
+
+#ifdef ADIOS2_AIO_HAVE_IO_URING
+    try
+    {
+        m_Queue.reset(new URingQueue(m_FileDescriptor, m_QueueDepth));
+    }
+    catch (std::exception &)
+    {
+        // kernel without io_uring or io_uring disabled, use POSIX AIO
+    }
+#endif
+    if (!m_Queue)
+    {
+        m_Queue.reset(new POSIXQueue(m_FileDescriptor, m_QueueDepth));
+    }
+
+    m_IsOpen = true;
+    if (m_OpenMode == Mode::Append)
+    {
+        m_Position = GetSize();
+    }
+}
+
+void FileAIO::SetParameters(const Params &parameters)
+{
+    for (const auto &pair : parameters)
+    {
+        const std::string key = helper::LowerCase(pair.first);
+
+        if (key == "queuedepth")
+        {
+            m_QueueDepth = helper::StringToSizeT(
+                pair.second, " in Parameter key=QueueDepth");
+            if (m_QueueDepth == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: QueueDepth must be larger than 0 for AIO "
+                    "transport\n");
+            }
+        }
+    }
+}
+
+void FileAIO::Write(const char *buffer, size_t size, size_t start)
+{
+    Status status;
+    ProfilerStart("write");
+    Enqueue(const_cast<char *>(buffer), size, status, start, true);
+    m_Queue->Wait(status);
+    ProfilerStop("write");
+    CheckStatus(status, "couldn't write to file " + m_Name);
+}
+
+void FileAIO::IWrite(const char *buffer, size_t size, Status &status,
+                     size_t start)
+{
+    Enqueue(const_cast<char *>(buffer), size, status, start, true);
+    m_Queue->Submit();
+}
+
+void FileAIO::WriteV(const std::vector<IOVec> &iov, size_t start)
+{
+    Status status;
+    ProfilerStart("write");
+    for (const IOVec &segment : iov)
+    {
+        Enqueue(const_cast<char *>(segment.Data), segment.Size, status, start,
+                true);
+        start = MaxSizeT;
+    }
+    m_Queue->Wait(status);
+    ProfilerStop("write");
+    CheckStatus(status, "couldn't write to file " + m_Name);
+}
+
+void FileAIO::Read(char *buffer, size_t size, size_t start)
+{
+    Status status;
+    ProfilerStart("read");
+    Enqueue(buffer, size, status, start, false);
+    m_Queue->Wait(status);
+    ProfilerStop("read");
+    CheckStatus(status, "couldn't read from file " + m_Name);
+}
+
+void FileAIO::IRead(char *buffer, size_t size, Status &status, size_t start)
+{
+    Enqueue(buffer, size, status, start, false);
+    m_Queue->Submit();
+}
+
+void FileAIO::Wait(Status &status)
+{
+    m_Queue->Wait(status);
+    CheckStatus(status, "couldn't complete request for file " + m_Name);
+}
+
+bool FileAIO::IsAsync() const noexcept { return true; }
+
+size_t FileAIO::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        m_Errno = errno;
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + SysErrMsg());
+    }
+    m_Errno = errno;
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void FileAIO::Flush() { m_Queue->WaitAll(); }
+
+void FileAIO::Close()
+{
+    m_Queue->WaitAll();
+    m_Queue.reset();
+
+    ProfilerStart("close");
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to AIO close" + SysErrMsg());
+    }
+
+    m_IsOpen = false;
+}
+
+void FileAIO::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileAIO::SeekToEnd()
+{
+    m_Queue->WaitAll();
+    m_Position = GetSize();
+}
+
+void FileAIO::SeekToBegin() { m_Position = 0; }
+
+// PRIVATE
+void FileAIO::Enqueue(char *buffer, size_t size, Status &status, size_t start,
+                      const bool isWrite)
+{
+    size_t position = (start == MaxSizeT) ? m_Position : start;
+    if (size == 0 && !m_Queue->IsPending(status))
+    {
+        status.Bytes = 0;
+        status.Running = false;
+        status.Successful = true;
+    }
+
+    while (size > 0)
+    {
+        const size_t bytes = std::min(size, DefaultMaxFileBatchSize);
+        m_Queue->Push({buffer, bytes, position, isWrite, &status});
+        buffer += bytes;
+        size -= bytes;
+        position += bytes;
+    }
+    m_Position = position;
+}
+
+void FileAIO::CheckStatus(const Status &status, const std::string hint) const
+{
+    if (!status.Successful)
+    {
+        const int error = m_Queue->m_Error;
+        throw std::ios_base::failure(
+            "ERROR: " + hint +
+            (error == 0 ? ", reached end of file" : ErrnoMessage(error)) +
+            ", in call to AIO\n");
+    }
+}
+
+void FileAIO::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptor == -1)
+    {
+        throw std::ios_base::failure("ERROR: " + hint + SysErrMsg());
+    }
+}
+
+std::string FileAIO::SysErrMsg() const { return ErrnoMessage(m_Errno); }
+
+} // end namespace transport
+} // end namespace adios2
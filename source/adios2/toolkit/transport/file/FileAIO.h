@@ -0,0 +1,117 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileAIO.h file I/O with several reads and writes in flight, using io_uring
+ * on Linux and POSIX AIO elsewhere or when io_uring is not available
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEAIO_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEAIO_H_
+
+#include <memory> //std::unique_ptr
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/** io_uring or POSIX AIO queue of requests, defined in FileAIO.cpp */
+class AIOQueue;
+
+/**
+ * File transport with asynchronous IWrite/IRead. Each call is split in
+ * requests of at most DefaultMaxFileBatchSize bytes that are queued and
+ * submitted together, up to QueueDepth requests are in flight. Write, WriteV
+ * and Read are blocking but still submit all their requests at once.
+ */
+class FileAIO : public Transport
+{
+
+public:
+    FileAIO(helper::Comm const &comm);
+
+    ~FileAIO();
+
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    /** QueueDepth: maximum number of requests in flight, default 64 */
+    void SetParameters(const Params &parameters) final;
+
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    /** buffer must not be modified until status is no longer Running */
+    void IWrite(const char *buffer, size_t size, Status &status,
+                size_t start = MaxSizeT) final;
+
+    /** Submits a request for each segment before waiting for any */
+    void WriteV(const std::vector<IOVec> &iov, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    /** buffer must not be accessed until status is no longer Running */
+    void IRead(char *buffer, size_t size, Status &status,
+               size_t start = MaxSizeT) final;
+
+    void Wait(Status &status) final;
+
+    bool IsAsync() const noexcept final;
+
+    size_t GetSize() final;
+
+    /** Waits for all requests in flight */
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+private:
+    /** created at Open, io_uring first, POSIX AIO if not available */
+    std::unique_ptr<AIOQueue> m_Queue;
+
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+
+    /** requests are positioned, current position for start == MaxSizeT */
+    size_t m_Position = 0;
+
+    size_t m_QueueDepth = 64;
+
+    /**
+     * Queues the requests of a read or write of size bytes and sets status
+     * to Running, requests are submitted only if the queue is full
+     */
+    void Enqueue(char *buffer, size_t size, Status &status, size_t start,
+                 const bool isWrite);
+
+    /** Throws if a completed status is not Successful */
+    void CheckStatus(const Status &status, const std::string hint) const;
+
+    /**
+     * Check if m_FileDescriptor is -1 after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEAIO_H_ */
@@ -0,0 +1,212 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMmap.cpp read-only file transport using POSIX mmap
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "FileMmap.h"
+
+#include <cstdio>      // remove
+#include <cstring>     // strerror, memcpy
+#include <errno.h>     // errno
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // open, fstat
+#include <sys/types.h> // open
+#include <unistd.h>    // close
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileMmap::FileMmap(helper::Comm const &comm) : Transport("File", "mmap", comm)
+{
+}
+
+FileMmap::~FileMmap()
+{
+    Unmap();
+    if (m_IsOpen)
+    {
+        close(m_FileDescriptor);
+    }
+}
+
+void FileMmap::Open(const std::string &name, const Mode openMode,
+                    const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+
+    if (m_OpenMode != Mode::Read)
+    {
+        throw std::invalid_argument(
+            "ERROR: mmap transport only supports Mode::Read, file " + m_Name +
+            ", in call to Open\n");
+    }
+
+    ProfilerStart("open");
+    errno = 0;
+    m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+    m_Errno = errno;
+    ProfilerStop("open");
+
+    CheckFile("couldn't open file " + m_Name + ", in call to mmap open");
+    m_IsOpen = true;
+    m_Position = 0;
+
+    MapFile(GetSize());
+}
+
+void FileMmap::Write(const char * /*buffer*/, size_t /*size*/,
+                     size_t /*start*/)
+{
+    throw std::invalid_argument("ERROR: mmap transport is read only, file " +
+                                m_Name + ", in call to Write\n");
+}
+
+void FileMmap::Read(char *buffer, size_t size, size_t start)
+{
+    if (start == MaxSizeT)
+    {
+        start = m_Position;
+    }
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    const char *data = MappedData(size, start);
+
+    ProfilerStart("read");
+    std::memcpy(buffer, data, size);
+    ProfilerStop("read");
+
+    m_Position = start + size;
+}
+
+const char *FileMmap::MappedData(size_t size, size_t start)
+{
+    MapFile(start + size);
+    return m_Data + start;
+}
+
+size_t FileMmap::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        m_Errno = errno;
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + SysErrMsg());
+    }
+    m_Errno = errno;
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void FileMmap::Flush() {}
+
+void FileMmap::Close()
+{
+    Unmap();
+
+    ProfilerStart("close");
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to mmap close" + SysErrMsg());
+    }
+
+    m_IsOpen = false;
+}
+
+void FileMmap::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileMmap::SeekToEnd() { m_Position = GetSize(); }
+
+void FileMmap::SeekToBegin() { m_Position = 0; }
+
+// PRIVATE
+void FileMmap::MapFile(const size_t requiredSize)
+{
+    if (requiredSize <= m_MappedSize)
+    {
+        return;
+    }
+
+    const size_t fileSize = GetSize();
+    if (fileSize < requiredSize)
+    {
+        throw std::ios_base::failure(
+            "ERROR: couldn't read " + std::to_string(requiredSize) +
+            " bytes from file " + m_Name + " of size " +
+            std::to_string(fileSize) + ", in call to mmap Read\n");
+    }
+
+    Unmap();
+
+    ProfilerStart("open");
+    errno = 0;
+    void *data =
+        mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, m_FileDescriptor, 0);
+    m_Errno = errno;
+    ProfilerStop("open");
+
+    if (data == MAP_FAILED)
+    {
+        throw std::ios_base::failure("ERROR: couldn't map file " + m_Name +
+                                     ", in call to mmap" + SysErrMsg());
+    }
+
+    m_Data = static_cast<char *>(data);
+    m_MappedSize = fileSize;
+}
+
+void FileMmap::Unmap() noexcept
+{
+    if (m_Data != nullptr)
+    {
+        munmap(m_Data, m_MappedSize);
+        m_Data = nullptr;
+        m_MappedSize = 0;
+    }
+}
+
+void FileMmap::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptor == -1)
+    {
+        throw std::ios_base::failure("ERROR: " + hint + SysErrMsg());
+    }
+}
+
+std::string FileMmap::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
+                       strerror(m_Errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
@@ -0,0 +1,96 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMmap.h read-only file transport using POSIX mmap
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * File transport that maps the whole file into memory at Open (read only).
+ * The mapping is extended if the file grows, e.g. when a reader is streaming
+ * a file that is still being written.
+ */
+class FileMmap : public Transport
+{
+
+public:
+    FileMmap(helper::Comm const &comm);
+
+    ~FileMmap();
+
+    /** Only Mode::Read is supported */
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    /** Throws, transport is read only */
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    const char *MappedData(size_t size, size_t start) final;
+
+    size_t GetSize() final;
+
+    /** Does nothing, transport is read only */
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+private:
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+
+    /** start of the mapped file, nullptr if nothing is mapped */
+    char *m_Data = nullptr;
+
+    /** size of the current mapping, file size at last (re)mapping */
+    size_t m_MappedSize = 0;
+
+    /** current stream position for Read with start = MaxSizeT */
+    size_t m_Position = 0;
+
+    /**
+     * Maps (again) the file if the current mapping is smaller than
+     * requiredSize
+     * @param requiredSize minimum number of bytes that must be mapped
+     */
+    void MapFile(const size_t requiredSize);
+
+    void Unmap() noexcept;
+
+    /**
+     * Check if m_FileDescriptor is -1 after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_ */
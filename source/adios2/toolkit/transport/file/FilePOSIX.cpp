@@ -9,13 +9,20 @@
  */
 #include "FilePOSIX.h"
 
+#include "adios2/helper/adiosFunctions.h" // helper::LowerCase, StringTo
+
+#include <algorithm>   // std::min
+#include <climits>     // IOV_MAX
+#include <cstdint>     // uintptr_t
 #include <cstdio>      // remove
-#include <cstring>     // strerror
+#include <cstdlib>     // posix_memalign, free
+#include <cstring>     // strerror, std::memcpy
 #include <errno.h>     // errno
 #include <fcntl.h>     // open
 #include <stddef.h>    // write output
 #include <sys/stat.h>  // open, fstat
 #include <sys/types.h> // open
+#include <sys/uio.h>   // writev
 #include <unistd.h>    // write, close
 
 /// \cond EXCLUDE_FROM_DOXYGEN
@@ -32,12 +39,23 @@ FilePOSIX::FilePOSIX(helper::Comm const &comm)
 {
 }
 
+namespace
+{
+/** staging memory for direct writes of unaligned buffers, in bytes */
+constexpr size_t DirectBufferSize = 8 * 1024 * 1024;
+}
+
 FilePOSIX::~FilePOSIX()
 {
     if (m_IsOpen)
     {
         close(m_FileDescriptor);
     }
+    if (m_DirectDescriptor != -1)
+    {
+        close(m_DirectDescriptor);
+    }
+    free(m_DirectBuffer);
 }
 
 void FilePOSIX::WaitForOpen()
@@ -120,6 +138,25 @@ void FilePOSIX::Open(const std::string &name, const Mode openMode,
     }
 }
 
+void FilePOSIX::SetParameters(const Params &parameters)
+{
+    for (const auto &pair : parameters)
+    {
+        const std::string key = helper::LowerCase(pair.first);
+        const std::string value = helper::LowerCase(pair.second);
+
+        if (key == "directio")
+        {
+            m_DirectIO =
+                helper::StringTo<bool>(value, " in Parameter key=DirectIO");
+#ifndef O_DIRECT
+            // not available on this platform, buffered writes
+            m_DirectIO = false;
+#endif
+        }
+    }
+}
+
 void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
 {
     auto lf_Write = [&](const char *buffer, size_t size) {
@@ -149,6 +186,12 @@ void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
     };
 
     WaitForOpen();
+    if (m_DirectIO && m_OpenMode != Mode::Read)
+    {
+        WriteDirect(buffer, size, start);
+        return;
+    }
+
     if (start != MaxSizeT)
     {
         errno = 0;
@@ -183,6 +226,84 @@ void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
     }
 }
 
+void FilePOSIX::WriteV(const std::vector<IOVec> &iov, size_t start)
+{
+    WaitForOpen();
+    if (m_DirectIO && m_OpenMode != Mode::Read)
+    {
+        Transport::WriteV(iov, start);
+        return;
+    }
+
+    if (start != MaxSizeT)
+    {
+        errno = 0;
+        const auto newPosition = lseek(m_FileDescriptor, start, SEEK_SET);
+        m_Errno = errno;
+
+        if (static_cast<size_t>(newPosition) != start)
+        {
+            throw std::ios_base::failure(
+                "ERROR: couldn't move to start position " +
+                std::to_string(start) + " in file " + m_Name +
+                ", in call to POSIX lseek" + SysErrMsg());
+        }
+    }
+
+    std::vector<struct iovec> segments;
+    segments.reserve(iov.size());
+    for (const IOVec &segment : iov)
+    {
+        if (segment.Size > 0)
+        {
+            segments.push_back(
+                {const_cast<char *>(segment.Data), segment.Size});
+        }
+    }
+
+    size_t current = 0;
+    while (current < segments.size())
+    {
+        const int count = static_cast<int>(std::min(
+            segments.size() - current, static_cast<size_t>(IOV_MAX)));
+
+        ProfilerStart("write");
+        errno = 0;
+        const auto writtenSize =
+            writev(m_FileDescriptor, &segments[current], count);
+        m_Errno = errno;
+        ProfilerStop("write");
+
+        if (writtenSize == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            throw std::ios_base::failure(
+                "ERROR: couldn't write to file " + m_Name +
+                ", in call to POSIX writev" + SysErrMsg());
+        }
+
+        // skip written segments, a partial write continues inside a segment
+        size_t remaining = static_cast<size_t>(writtenSize);
+        while (current < segments.size() &&
+               remaining >= segments[current].iov_len)
+        {
+            remaining -= segments[current].iov_len;
+            ++current;
+        }
+
+        if (remaining > 0)
+        {
+            segments[current].iov_base =
+                static_cast<char *>(segments[current].iov_base) + remaining;
+            segments[current].iov_len -= remaining;
+        }
+    }
+}
+
 void FilePOSIX::Read(char *buffer, size_t size, size_t start)
 {
     auto lf_Read = [&](char *buffer, size_t size) {
@@ -268,6 +389,11 @@ void FilePOSIX::Close()
 {
     WaitForOpen();
     ProfilerStart("close");
+    if (m_DirectDescriptor != -1)
+    {
+        close(m_DirectDescriptor);
+        m_DirectDescriptor = -1;
+    }
     errno = 0;
     const int status = close(m_FileDescriptor);
     m_Errno = errno;
@@ -293,6 +419,141 @@ void FilePOSIX::Delete()
     std::remove(m_Name.c_str());
 }
 
+void FilePOSIX::WriteDirect(const char *buffer, size_t size, size_t start)
+{
+    size_t offset = start;
+    if (start == MaxSizeT)
+    {
+        errno = 0;
+        const auto position = lseek(m_FileDescriptor, 0, SEEK_CUR);
+        m_Errno = errno;
+        if (position == -1)
+        {
+            throw std::ios_base::failure(
+                "ERROR: couldn't get current position in file " + m_Name +
+                ", in call to POSIX lseek" + SysErrMsg());
+        }
+        offset = static_cast<size_t>(position);
+    }
+
+#ifdef O_DIRECT
+    if (m_DirectDescriptor == -1)
+    {
+        m_DirectDescriptor = open(m_Name.c_str(), O_WRONLY | O_DIRECT);
+    }
+#endif
+    if (m_DirectDescriptor == -1)
+    {
+        // e.g. tmpfs, this and later writes go through the page cache
+        m_DirectIO = false;
+    }
+
+    // aligned file range, head and tail go through the page cache
+    const size_t alignment = DefaultDirectIOAlignment;
+    const size_t head =
+        std::min(size, (alignment - offset % alignment) % alignment);
+    const size_t body = (size - head) / alignment * alignment;
+
+    ProfilerStart("write");
+    PWrite(m_FileDescriptor, buffer, head, offset);
+
+    size_t done = head;
+    if (m_DirectDescriptor != -1 && body > 0)
+    {
+        const char *data = buffer + head;
+        if (reinterpret_cast<uintptr_t>(data) % alignment == 0)
+        {
+            if (PWrite(m_DirectDescriptor, data, body, offset + head))
+            {
+                done += body;
+            }
+        }
+        else
+        {
+            if (m_DirectBuffer == nullptr &&
+                posix_memalign(reinterpret_cast<void **>(&m_DirectBuffer),
+                               alignment, DirectBufferSize) != 0)
+            {
+                m_DirectBuffer = nullptr;
+            }
+
+            // staged through aligned memory, stops at a rejected write
+            while (m_DirectBuffer != nullptr && done < head + body)
+            {
+                const size_t bytes =
+                    std::min(head + body - done, DirectBufferSize);
+                std::memcpy(m_DirectBuffer, buffer + done, bytes);
+                if (!PWrite(m_DirectDescriptor, m_DirectBuffer, bytes,
+                            offset + done))
+                {
+                    break;
+                }
+                done += bytes;
+            }
+        }
+
+        if (done < head + body)
+        {
+            // file system doesn't support O_DIRECT for this file
+            m_DirectIO = false;
+        }
+    }
+
+    PWrite(m_FileDescriptor, buffer + done, size - done, offset + done);
+    ProfilerStop("write");
+
+    // same file position as a buffered write
+    errno = 0;
+    const auto newPosition =
+        lseek(m_FileDescriptor, static_cast<off_t>(offset + size), SEEK_SET);
+    m_Errno = errno;
+    if (newPosition == -1)
+    {
+        throw std::ios_base::failure(
+            "ERROR: couldn't move to position " +
+            std::to_string(offset + size) + " in file " + m_Name +
+            ", in call to POSIX lseek" + SysErrMsg());
+    }
+}
+
+bool FilePOSIX::PWrite(const int descriptor, const char *buffer, size_t size,
+                       size_t offset)
+{
+    while (size > 0)
+    {
+        // direct writes must stay multiples of the alignment
+        const size_t batchSize = DefaultMaxFileBatchSize /
+                                 DefaultDirectIOAlignment *
+                                 DefaultDirectIOAlignment;
+        errno = 0;
+        const auto writtenSize =
+            pwrite(descriptor, buffer, std::min(size, batchSize),
+                   static_cast<off_t>(offset));
+        m_Errno = errno;
+
+        if (writtenSize == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EINVAL && descriptor == m_DirectDescriptor)
+            {
+                return false;
+            }
+
+            throw std::ios_base::failure(
+                "ERROR: couldn't write to file " + m_Name +
+                ", in call to POSIX pwrite" + SysErrMsg());
+        }
+
+        buffer += writtenSize;
+        size -= writtenSize;
+        offset += writtenSize;
+    }
+    return true;
+}
+
 void FilePOSIX::CheckFile(const std::string hint) const
 {
     if (m_FileDescriptor == -1)
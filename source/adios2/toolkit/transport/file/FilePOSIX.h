@@ -37,8 +37,18 @@ public:
     void Open(const std::string &name, const Mode openMode,
               const bool async = false) final;
 
+    /**
+     * DirectIO: true writes aligned parts of the data with O_DIRECT,
+     * bypassing the page cache, default false
+     */
+    void SetParameters(const Params &parameters) final;
+
     void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
 
+    /** Uses writev to write all segments with as few system calls as
+     * possible, with DirectIO each segment is written with Write */
+    void WriteV(const std::vector<IOVec> &iov, size_t start = MaxSizeT) final;
+
     void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
 
     size_t GetSize() final;
@@ -61,6 +71,27 @@ private:
     bool m_IsOpening = false;
     std::future<int> m_OpenFuture;
 
+    /** DirectIO parameter, false if the file system rejects O_DIRECT */
+    bool m_DirectIO = false;
+    /** second handle to the file opened with O_DIRECT at the first write */
+    int m_DirectDescriptor = -1;
+    /** aligned staging memory for direct writes from unaligned buffers */
+    char *m_DirectBuffer = nullptr;
+
+    /**
+     * Writes the DefaultDirectIOAlignment-aligned part of buffer with
+     * m_DirectDescriptor, the unaligned head and tail with m_FileDescriptor
+     */
+    void WriteDirect(const char *buffer, size_t size, size_t start);
+
+    /**
+     * pwrite loop on a handle
+     * @return false if a direct write was rejected (EINVAL), other errors
+     * throw
+     */
+    bool PWrite(const int descriptor, const char *buffer, size_t size,
+                size_t offset);
+
     /**
      * Check if m_FileDescriptor is -1 after an operation
      * @param hint exception message
@@ -0,0 +1,510 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileStriped.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "FileStriped.h"
+
+#include "adios2/helper/adiosFunctions.h" // helper::LowerCase, StringTo
+
+#include <algorithm>   // std::min
+#include <cstdio>      // remove
+#include <cstring>     // strerror
+#include <errno.h>     // errno
+#include <exception>   // std::exception_ptr
+#include <fcntl.h>     // open
+#include <fstream>     // descriptor
+#include <future>      // std::async
+#include <sstream>     // std::istringstream
+#include <stdexcept>   // std::invalid_argument
+#include <sys/stat.h>  // open, fstat
+#include <sys/types.h> // open
+#include <unistd.h>    // pwrite, pread, close
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+namespace
+{
+/** first line of the descriptor, followed by stripe size and file names */
+const std::string StripeTag("ADIOS-STRIPE 1");
+}
+
+FileStriped::FileStriped(helper::Comm const &comm)
+: Transport("File", "Striped", comm)
+{
+}
+
+FileStriped::~FileStriped() { CloseStripes(); }
+
+void FileStriped::Open(const std::string &name, const Mode openMode,
+                       const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    m_Position = 0;
+
+    ProfilerStart("open");
+    switch (m_OpenMode)
+    {
+
+    case (Mode::Write):
+        CreateLayout();
+        OpenStripes(O_WRONLY | O_CREAT | O_TRUNC);
+        break;
+
+    case (Mode::Append):
+        if (!ReadLayout())
+        {
+            CreateLayout();
+        }
+        OpenStripes(O_RDWR | O_CREAT);
+        break;
+
+    case (Mode::Read):
+        if (!ReadLayout())
+        {
+            ProfilerStop("open");
+            throw std::ios_base::failure(
+                "ERROR: couldn't open file " + m_Name +
+                ", not a striped file, in call to Striped open");
+        }
+        OpenStripes(O_RDONLY);
+        break;
+
+    default:
+        ProfilerStop("open");
+        throw std::ios_base::failure("ERROR: unknown open mode for file " +
+                                     m_Name + ", in call to Striped open");
+    }
+    ProfilerStop("open");
+
+    m_IsOpen = true;
+    if (m_OpenMode == Mode::Append)
+    {
+        m_Position = GetSize();
+    }
+}
+
+void FileStriped::SetParameters(const Params &parameters)
+{
+    for (const auto &pair : parameters)
+    {
+        const std::string key = helper::LowerCase(pair.first);
+        const std::string &value = pair.second;
+
+        if (key == "stripecount")
+        {
+            m_StripeCount =
+                helper::StringToSizeT(value, " in Parameter key=StripeCount");
+        }
+        else if (key == "stripesize")
+        {
+            m_StripeSize = helper::StringToByteUnits(
+                helper::LowerCase(value), " in Parameter key=StripeSize");
+        }
+        else if (key == "stripedirs")
+        {
+            m_StripeDirs.clear();
+            std::istringstream dirs(value);
+            std::string dir;
+            while (std::getline(dirs, dir, ','))
+            {
+                if (!dir.empty())
+                {
+                    m_StripeDirs.push_back(dir);
+                }
+            }
+        }
+        else if (key == "threads")
+        {
+            m_Threads =
+                helper::StringToSizeT(value, " in Parameter key=Threads");
+        }
+    }
+
+    if (m_StripeSize == 0)
+    {
+        throw std::invalid_argument(
+            "ERROR: StripeSize must be larger than 0, in call to Striped "
+            "SetParameters\n");
+    }
+}
+
+void FileStriped::Write(const char *buffer, size_t size, size_t start)
+{
+    if (m_OpenMode == Mode::Read)
+    {
+        throw std::ios_base::failure("ERROR: file " + m_Name +
+                                     " is opened for reading, in call to "
+                                     "Striped write");
+    }
+    Transfer(const_cast<char *>(buffer), size, start, true);
+}
+
+void FileStriped::Read(char *buffer, size_t size, size_t start)
+{
+    Transfer(buffer, size, start, false);
+}
+
+size_t FileStriped::GetSize()
+{
+    // last logical byte over all files, they can end in the middle of a chunk
+    size_t size = 0;
+    for (size_t s = 0; s < m_FileDescriptors.size(); ++s)
+    {
+        struct stat fileStat;
+        errno = 0;
+        if (fstat(m_FileDescriptors[s], &fileStat) == -1)
+        {
+            m_Errno = errno;
+            throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                         m_StripeNames[s] + SysErrMsg());
+        }
+
+        const size_t stripeSize = static_cast<size_t>(fileStat.st_size);
+        if (stripeSize == 0)
+        {
+            continue;
+        }
+        const size_t row = (stripeSize - 1) / m_StripeSize;
+        const size_t end = (row * m_StripeCount + s) * m_StripeSize +
+                           (stripeSize - 1) % m_StripeSize + 1;
+        size = std::max(size, end);
+    }
+    return size;
+}
+
+void FileStriped::Flush() {}
+
+void FileStriped::Close()
+{
+    ProfilerStart("close");
+    int status = 0;
+    for (int &fd : m_FileDescriptors)
+    {
+        errno = 0;
+        if (close(fd) == -1)
+        {
+            status = -1;
+            m_Errno = errno;
+        }
+        fd = -1;
+    }
+    m_FileDescriptors.clear();
+    ProfilerStop("close");
+
+    m_IsOpen = false;
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to Striped close" +
+                                     SysErrMsg());
+    }
+}
+
+void FileStriped::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    for (const std::string &stripeName : m_StripeNames)
+    {
+        std::remove(stripeName.c_str());
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileStriped::SeekToEnd() { m_Position = GetSize(); }
+
+void FileStriped::SeekToBegin() { m_Position = 0; }
+
+// PRIVATE
+void FileStriped::CreateLayout()
+{
+    if (m_StripeCount == 0)
+    {
+        m_StripeCount = m_StripeDirs.empty() ? 4 : m_StripeDirs.size();
+    }
+    if (m_Threads == 0)
+    {
+        m_Threads = m_StripeCount;
+    }
+
+    // name without directory, next to the logical file, or under StripeDirs
+    const size_t separator = m_Name.find_last_of(PathSeparator);
+    const std::string baseName = (separator == std::string::npos)
+                                     ? m_Name
+                                     : m_Name.substr(separator + 1);
+    std::string relativeName = m_Name;
+    while (!relativeName.empty() && relativeName[0] == PathSeparator)
+    {
+        relativeName.erase(0, 1);
+    }
+
+    std::vector<std::string> recordedNames;
+    m_StripeNames.clear();
+    for (size_t s = 0; s < m_StripeCount; ++s)
+    {
+        const std::string suffix(".stripe" + std::to_string(s));
+        if (m_StripeDirs.empty())
+        {
+            m_StripeNames.push_back(m_Name + suffix);
+            recordedNames.push_back(baseName + suffix);
+        }
+        else
+        {
+            m_StripeNames.push_back(m_StripeDirs[s % m_StripeDirs.size()] +
+                                    PathSeparator + relativeName + suffix);
+            MkDir(m_StripeNames.back());
+            recordedNames.push_back(m_StripeNames.back());
+        }
+    }
+
+    std::ofstream descriptor(m_Name, std::ios::trunc);
+    descriptor << StripeTag << "\n" << m_StripeSize << "\n";
+    for (const std::string &recordedName : recordedNames)
+    {
+        descriptor << recordedName << "\n";
+    }
+    descriptor.close();
+    if (!descriptor)
+    {
+        throw std::ios_base::failure(
+            "ERROR: couldn't write stripe descriptor " + m_Name +
+            ", in call to Striped open");
+    }
+}
+
+bool FileStriped::ReadLayout()
+{
+    std::ifstream descriptor(m_Name);
+    std::string tag;
+    if (!descriptor || !std::getline(descriptor, tag) || tag.empty())
+    {
+        return false;
+    }
+
+    size_t stripeSize = 0;
+    if (tag != StripeTag || !(descriptor >> stripeSize) || stripeSize == 0)
+    {
+        throw std::ios_base::failure("ERROR: file " + m_Name +
+                                     " is not a valid stripe descriptor, in "
+                                     "call to Striped open");
+    }
+    m_StripeSize = stripeSize;
+
+    // names without a separator are relative to the descriptor's directory
+    const size_t separator = m_Name.find_last_of(PathSeparator);
+    const std::string path = (separator == std::string::npos)
+                                 ? std::string()
+                                 : m_Name.substr(0, separator + 1);
+
+    m_StripeNames.clear();
+    std::string stripeName;
+    while (descriptor >> stripeName)
+    {
+        if (stripeName.find(PathSeparator) == std::string::npos)
+        {
+            stripeName = path + stripeName;
+        }
+        m_StripeNames.push_back(stripeName);
+    }
+
+    if (m_StripeNames.empty())
+    {
+        throw std::ios_base::failure("ERROR: stripe descriptor " + m_Name +
+                                     " has no files, in call to Striped open");
+    }
+    m_StripeCount = m_StripeNames.size();
+    if (m_Threads == 0)
+    {
+        m_Threads = m_StripeCount;
+    }
+    return true;
+}
+
+void FileStriped::OpenStripes(const int flags)
+{
+    m_FileDescriptors.reserve(m_StripeNames.size());
+    for (const std::string &stripeName : m_StripeNames)
+    {
+        errno = 0;
+        const int fd = open(stripeName.c_str(), flags, 0666);
+        m_Errno = errno;
+        if (fd == -1)
+        {
+            CloseStripes();
+            throw std::ios_base::failure("ERROR: couldn't open file " +
+                                         stripeName + " of " + m_Name +
+                                         ", in call to Striped open" +
+                                         SysErrMsg());
+        }
+        m_FileDescriptors.push_back(fd);
+    }
+}
+
+void FileStriped::Transfer(char *buffer, size_t size, size_t start,
+                           const bool isWrite)
+{
+    CheckFile("file " + m_Name + " is not open, in call to Striped " +
+              (isWrite ? "write" : "read"));
+
+    size_t position = (start == MaxSizeT) ? m_Position : start;
+
+    std::vector<std::vector<Chunk>> stripeChunks(m_StripeCount);
+    size_t remaining = size;
+    while (remaining > 0)
+    {
+        const size_t chunk = position / m_StripeSize;
+        const size_t offset = position % m_StripeSize;
+        const size_t chunkSize = std::min(m_StripeSize - offset, remaining);
+        stripeChunks[chunk % m_StripeCount].push_back(
+            {buffer, chunkSize,
+             (chunk / m_StripeCount) * m_StripeSize + offset});
+
+        buffer += chunkSize;
+        position += chunkSize;
+        remaining -= chunkSize;
+    }
+
+    ProfilerStart(isWrite ? "write" : "read");
+    // stripes are distributed over at most m_Threads threads, this one
+    // included, each thread takes every m_Threads-th stripe
+    const size_t threads = std::max<size_t>(
+        1, std::min(m_Threads, std::min(m_StripeCount,
+                                        (size + m_StripeSize - 1) /
+                                            m_StripeSize)));
+    auto lf_TransferStripes = [&](const size_t first) {
+        for (size_t s = first; s < m_StripeCount; s += threads)
+        {
+            if (!stripeChunks[s].empty())
+            {
+                TransferChunks(s, stripeChunks[s], isWrite);
+            }
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads - 1);
+    std::exception_ptr error;
+    try
+    {
+        for (size_t t = 1; t < threads; ++t)
+        {
+            futures.push_back(
+                std::async(std::launch::async, lf_TransferStripes, t));
+        }
+        lf_TransferStripes(0);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // all threads must be done with the buffer before returning
+    for (auto &future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    ProfilerStop(isWrite ? "write" : "read");
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    m_Position = position;
+}
+
+void FileStriped::TransferChunks(const size_t stripe,
+                                 const std::vector<Chunk> &chunks,
+                                 const bool isWrite)
+{
+    const int fd = m_FileDescriptors[stripe];
+    for (const Chunk &chunk : chunks)
+    {
+        char *buffer = chunk.Buffer;
+        size_t size = chunk.Size;
+        size_t offset = chunk.Offset;
+        while (size > 0)
+        {
+            // m_Errno is shared between threads, errno is not
+            errno = 0;
+            const auto transferred =
+                isWrite ? pwrite(fd, buffer, size, static_cast<off_t>(offset))
+                        : pread(fd, buffer, size, static_cast<off_t>(offset));
+            const int error = errno;
+
+            if (transferred == -1 && error == EINTR)
+            {
+                continue;
+            }
+            if (transferred <= 0)
+            {
+                const std::string reason =
+                    (transferred == 0) ? std::string(": unexpected end of file")
+                                       : std::string(": errno = " +
+                                                     std::to_string(error) +
+                                                     ": " + strerror(error));
+                throw std::ios_base::failure(
+                    "ERROR: couldn't " +
+                    std::string(isWrite ? "write to" : "read from") +
+                    " file " + m_StripeNames[stripe] + " of " + m_Name +
+                    ", in call to Striped " + (isWrite ? "pwrite" : "pread") +
+                    reason);
+            }
+
+            buffer += transferred;
+            offset += static_cast<size_t>(transferred);
+            size -= static_cast<size_t>(transferred);
+        }
+    }
+}
+
+void FileStriped::CloseStripes() noexcept
+{
+    for (const int fd : m_FileDescriptors)
+    {
+        close(fd);
+    }
+    m_FileDescriptors.clear();
+}
+
+void FileStriped::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptors.size() != m_StripeCount || m_StripeCount == 0)
+    {
+        throw std::ios_base::failure("ERROR: " + hint);
+    }
+}
+
+std::string FileStriped::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
+                       strerror(m_Errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
@@ -0,0 +1,126 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileStriped.h file I/O striping one logical file round-robin across several
+ * physical files, possibly on different devices
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILESTRIPED_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILESTRIPED_H_
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * Chunk k of StripeSize bytes of the logical file is stored in physical file
+ * k % StripeCount. The logical file itself is a small text descriptor with
+ * the stripe size and the physical file names, so it can be read back
+ * without knowing the parameters used to write it. Reads and writes
+ * spanning several physical files run one thread per file.
+ */
+class FileStriped : public Transport
+{
+
+public:
+    FileStriped(helper::Comm const &comm);
+
+    ~FileStriped();
+
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    /**
+     * StripeCount: number of physical files, default 4 or the number of
+     * StripeDirs. StripeSize: chunk size, default 1Mb. StripeDirs: comma
+     * separated directories the physical files go to, round-robin, default
+     * next to the logical file. Threads: maximum threads per call, default
+     * StripeCount.
+     */
+    void SetParameters(const Params &parameters) final;
+
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    size_t GetSize() final;
+
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+private:
+    /** a piece of a call within one physical file */
+    struct Chunk
+    {
+        char *Buffer;
+        size_t Size;
+        size_t Offset;
+    };
+
+    size_t m_StripeCount = 0;
+    size_t m_StripeSize = 1024 * 1024;
+    std::vector<std::string> m_StripeDirs;
+    size_t m_Threads = 0;
+
+    /** physical files, as opened and as recorded in the descriptor */
+    std::vector<std::string> m_StripeNames;
+    std::vector<int> m_FileDescriptors;
+    int m_Errno = 0;
+
+    /** logical position for start == MaxSizeT */
+    size_t m_Position = 0;
+
+    /** sets m_StripeNames from parameters and writes the descriptor */
+    void CreateLayout();
+
+    /**
+     * Sets m_StripeSize and m_StripeNames from the descriptor
+     * @return false if the descriptor is empty or does not exist
+     */
+    bool ReadLayout();
+
+    /** opens all m_StripeNames with flags, closes them if one fails */
+    void OpenStripes(const int flags);
+
+    /**
+     * Splits a read or write of the logical file in chunks of the physical
+     * files, the physical files are accessed in parallel
+     */
+    void Transfer(char *buffer, size_t size, size_t start, const bool isWrite);
+
+    /** pwrite or pread of all chunks of physical file stripe */
+    void TransferChunks(const size_t stripe, const std::vector<Chunk> &chunks,
+                        const bool isWrite);
+
+    void CloseStripes() noexcept;
+
+    /**
+     * Check if m_FileDescriptors are valid after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILESTRIPED_H_ */
@@ -16,8 +16,13 @@
 #include "adios2/helper/adiosFunctions.h" //CreateDirectory
 
 /// transports
+#ifdef ADIOS2_HAVE_AIO
+#include "adios2/toolkit/transport/file/FileAIO.h"
+#endif
 #ifndef _WIN32
+#include "adios2/toolkit/transport/file/FileMmap.h"
 #include "adios2/toolkit/transport/file/FilePOSIX.h"
+#include "adios2/toolkit/transport/file/FileStriped.h"
 #endif
 #ifdef ADIOS2_HAVE_IME
 #include "adios2/toolkit/transport/file/FileIME.h"
@@ -198,6 +203,103 @@ void TransportMan::WriteFiles(const char *buffer, const size_t size,
     }
 }
 
+void TransportMan::WriteFiles(const std::vector<Transport::IOVec> &iov,
+                              const int transportIndex)
+{
+    if (transportIndex == -1)
+    {
+        for (auto &transportPair : m_Transports)
+        {
+            auto &transport = transportPair.second;
+            if (transport->m_Type == "File")
+            {
+                transport->WriteV(iov);
+            }
+        }
+    }
+    else
+    {
+        auto itTransport = m_Transports.find(transportIndex);
+        CheckFile(itTransport, ", in call to WriteFiles with index " +
+                                   std::to_string(transportIndex));
+        itTransport->second->WriteV(iov);
+    }
+}
+
+void TransportMan::IWriteFiles(const char *buffer, const size_t size,
+                               const int transportIndex)
+{
+    auto lf_IWrite = [&](const size_t index, Transport &transport) {
+        if (transport.IsAsync())
+        {
+            transport.IWrite(buffer, size, m_WriteStatus[index]);
+        }
+        else
+        {
+            transport.Write(buffer, size);
+        }
+    };
+
+    if (transportIndex == -1)
+    {
+        for (auto &transportPair : m_Transports)
+        {
+            auto &transport = transportPair.second;
+            if (transport->m_Type == "File")
+            {
+                lf_IWrite(transportPair.first, *transport);
+            }
+        }
+    }
+    else
+    {
+        auto itTransport = m_Transports.find(transportIndex);
+        CheckFile(itTransport, ", in call to IWriteFiles with index " +
+                                   std::to_string(transportIndex));
+        lf_IWrite(itTransport->first, *itTransport->second);
+    }
+}
+
+void TransportMan::WaitFiles(const int transportIndex)
+{
+    for (auto &statusPair : m_WriteStatus)
+    {
+        if (transportIndex != -1 &&
+            statusPair.first != static_cast<size_t>(transportIndex))
+        {
+            continue;
+        }
+
+        auto itTransport = m_Transports.find(statusPair.first);
+        if (itTransport != m_Transports.end() && itTransport->second->m_IsOpen)
+        {
+            itTransport->second->Wait(statusPair.second);
+        }
+    }
+}
+
+bool TransportMan::AsyncFiles(const int transportIndex) const noexcept
+{
+    bool hasFiles = false;
+    for (const auto &transportPair : m_Transports)
+    {
+        const auto &transport = transportPair.second;
+        if (transport->m_Type != "File" ||
+            (transportIndex != -1 &&
+             transportPair.first != static_cast<size_t>(transportIndex)))
+        {
+            continue;
+        }
+
+        if (!transport->IsAsync())
+        {
+            return false;
+        }
+        hasFiles = true;
+    }
+    return hasFiles;
+}
+
 void TransportMan::WriteFileAt(const char *buffer, const size_t size,
                                const size_t start, const int transportIndex)
 {
@@ -282,6 +384,35 @@ void TransportMan::ReadFile(char *buffer, const size_t size, const size_t start,
     itTransport->second->Read(buffer, size, start);
 }
 
+const char *TransportMan::MappedFileData(const size_t size,
+                                         const size_t start,
+                                         const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to MappedFileData with index " +
+                               std::to_string(transportIndex));
+    return itTransport->second->MappedData(size, start);
+}
+
+void TransportMan::IReadFile(char *buffer, const size_t size,
+                             Transport::Status &status, const size_t start,
+                             const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to IReadFile with index " +
+                               std::to_string(transportIndex));
+    itTransport->second->IRead(buffer, size, status, start);
+}
+
+void TransportMan::WaitFile(Transport::Status &status,
+                            const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to WaitFile with index " +
+                               std::to_string(transportIndex));
+    itTransport->second->Wait(status);
+}
+
 void TransportMan::FlushFiles(const int transportIndex)
 {
     if (transportIndex == -1)
@@ -437,6 +568,39 @@ TransportMan::OpenFileTransport(const std::string &fileName,
                     " transport does not support buffered I/O.");
             }
         }
+        else if (library == "mmap" || library == "MMAP")
+        {
+            transport = std::make_shared<transport::FileMmap>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
+        else if (library == "stripe" || library == "Striped" ||
+                 library == "striped")
+        {
+            transport = std::make_shared<transport::FileStriped>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
+#endif
+#ifdef ADIOS2_HAVE_AIO
+        else if (library == "AIO" || library == "aio")
+        {
+            transport = std::make_shared<transport::FileAIO>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
 #endif
 #ifdef ADIOS2_HAVE_IME
         else if (library == "IME" || library == "ime")
@@ -118,6 +118,36 @@ public:
     void WriteFiles(const char *buffer, const size_t size,
                     const int transportIndex = -1);
 
+    /**
+     * Gathered write of memory segments to file transports
+     * @param iov segments written one after the other
+     * @param transportIndex
+     */
+    void WriteFiles(const std::vector<Transport::IOVec> &iov,
+                    const int transportIndex = -1);
+
+    /**
+     * Starts a write to file transports without waiting for it to complete,
+     * transports not supporting asynchronous I/O write synchronously
+     * @param buffer must not be modified until WaitFiles returns
+     * @param size
+     * @param transportIndex
+     */
+    void IWriteFiles(const char *buffer, const size_t size,
+                     const int transportIndex = -1);
+
+    /**
+     * Waits for the writes started with IWriteFiles, throws if one failed
+     * @param transportIndex -1: all transports, otherwise index in m_Transports
+     */
+    void WaitFiles(const int transportIndex = -1);
+
+    /**
+     * @param transportIndex -1: all transports, otherwise index in m_Transports
+     * @return true if all file transports implement asynchronous I/O
+     */
+    bool AsyncFiles(const int transportIndex = -1) const noexcept;
+
     /**
      * Write data to a specific location in files
      * @param transportIndex
@@ -139,6 +169,37 @@ public:
     void ReadFile(char *buffer, const size_t size, const size_t start = 0,
                   const size_t transportIndex = 0);
 
+    /**
+     * Direct access to contents of a single file without copying, only
+     * possible if the file transport is memory mapped (e.g. Library=mmap)
+     * @param size
+     * @param start
+     * @param transportIndex
+     * @return pointer to file contents, nullptr if not supported by transport
+     */
+    const char *MappedFileData(const size_t size, const size_t start = 0,
+                               const size_t transportIndex = 0);
+
+    /**
+     * Starts reading from a single file without waiting, only for
+     * transports with AsyncFiles true
+     * @param buffer must not be accessed until WaitFile returns
+     * @param size
+     * @param status passed to WaitFile
+     * @param start
+     * @param transportIndex
+     */
+    void IReadFile(char *buffer, const size_t size, Transport::Status &status,
+                   const size_t start = 0, const size_t transportIndex = 0);
+
+    /**
+     * Waits for the reads started with IReadFile sharing status, throws if
+     * one failed
+     * @param status
+     * @param transportIndex
+     */
+    void WaitFile(Transport::Status &status, const size_t transportIndex = 0);
+
     /**
      * Flush file or files depending on transport index. Throws an exception
      * if transport is not a file when transportIndex > -1.
@@ -178,6 +239,9 @@ public:
 protected:
     helper::Comm const &m_Comm;
 
+    /** status of the writes started with IWriteFiles per transport index */
+    std::unordered_map<size_t, Transport::Status> m_WriteStatus;
+
     std::shared_ptr<Transport> OpenFileTransport(const std::string &fileName,
                                                  const Mode openMode,
                                                  const Params &parameters,
@@ -0,0 +1,138 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+class BPBurstBufferDrain : public ::testing::Test
+{
+public:
+    BPBurstBufferDrain() = default;
+};
+
+TEST_F(BPBurstBufferDrain, DrainedStepsWithBandwidthLimit)
+{
+    const std::string fname("BPBurstBufferDrain.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 100000;
+    const size_t NSteps = 5;
+    const size_t bandwidth = 2 * 1024 * 1024;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+
+    std::vector<double> data(Nx);
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameters({{"BurstBufferPath", "BPBurstBufferDrain.bb"},
+                          {"BurstBufferDrainMaxBandwidth", "2Mb"}});
+
+        const adios2::Dims shape{static_cast<size_t>(mpiSize) * Nx};
+        const adios2::Dims start{static_cast<size_t>(mpiRank) * Nx};
+        const adios2::Dims count{Nx};
+        auto var = io.DefineVariable<double>("r64", shape, start, count);
+
+        const auto tStart = std::chrono::steady_clock::now();
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            std::iota(data.begin(), data.end(),
+                      static_cast<double>(step * Nx));
+            bpWriter.BeginStep();
+            bpWriter.Put(var, data.data());
+            bpWriter.EndStep();
+            EXPECT_LE(bpWriter.DrainedSteps(), bpWriter.CurrentStep());
+        }
+
+        // the drain completes in the background
+        size_t drained = bpWriter.DrainedSteps();
+        for (size_t i = 0; i < 6000 && drained < NSteps; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            drained = bpWriter.DrainedSteps();
+        }
+        EXPECT_EQ(drained, NSteps);
+
+        if (mpiRank == 0)
+        {
+            // at least the data of this process went through the limit
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - tStart;
+            const double minSeconds =
+                static_cast<double>(NSteps * Nx * sizeof(double)) /
+                static_cast<double>(bandwidth);
+            EXPECT_GE(elapsed.count(), 0.9 * minSeconds);
+        }
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+        auto var = io.InquireVariable<double>("r64");
+        ASSERT_TRUE(var);
+        EXPECT_EQ(var.Steps(), NSteps);
+
+        std::vector<double> in;
+        var.SetSelection({{static_cast<size_t>(mpiRank) * Nx}, {Nx}});
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            var.SetStepSelection({step, 1});
+            bpReader.Get(var, in, adios2::Mode::Sync);
+            ASSERT_EQ(in.size(), Nx);
+            EXPECT_EQ(in.front(), static_cast<double>(step * Nx));
+            EXPECT_EQ(in.back(), static_cast<double>(step * Nx + Nx - 1));
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
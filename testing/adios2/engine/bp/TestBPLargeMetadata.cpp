@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <cstring>
 
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 
@@ -156,6 +157,471 @@ TEST_F(BPLargeMetadata, ManyLongStrings)
     }
 }
 
+TEST_F(BPLargeMetadata, ManyStepsMetadataThreads)
+{
+    const std::string fname("BPLargeMetadataThreads.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 10;
+    const std::size_t NSteps = 10;
+    const std::size_t NVars = 100;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+
+        const adios2::Dims shape{static_cast<size_t>(mpiSize * Nx)};
+        const adios2::Dims start{static_cast<size_t>(mpiRank * Nx)};
+        const adios2::Dims count{Nx};
+
+        std::vector<adios2::Variable<double>> varsR64(NVars);
+        for (size_t i = 0; i < NVars; ++i)
+        {
+            varsR64[i] = io.DefineVariable<double>(
+                "varR64_" + std::to_string(i), shape, start, count);
+        }
+        auto varStep = io.DefineVariable<uint64_t>("step");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<double> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t i = 0; i < NVars; ++i)
+            {
+                // odd variables are only written in even steps
+                if (i % 2 == 1 && step % 2 == 1)
+                {
+                    continue;
+                }
+                for (size_t j = 0; j < Nx; ++j)
+                {
+                    data[j] = static_cast<double>(i * 1000 + step * 10 + j);
+                }
+                bpWriter.Put(varsR64[i], data.data(), adios2::Mode::Sync);
+            }
+            if (mpiRank == 0)
+            {
+                bpWriter.Put(varStep, static_cast<uint64_t>(step));
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("MetadataThreads", "4");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto varStep = io.InquireVariable<uint64_t>("step");
+        EXPECT_TRUE(varStep);
+        EXPECT_EQ(varStep.Steps(), NSteps);
+        EXPECT_EQ(varStep.Min(), 0);
+        EXPECT_EQ(varStep.Max(), NSteps - 1);
+
+        std::vector<double> data;
+        for (size_t i = 0; i < NVars; ++i)
+        {
+            auto var =
+                io.InquireVariable<double>("varR64_" + std::to_string(i));
+            EXPECT_TRUE(var);
+            const size_t varSteps = (i % 2 == 1) ? NSteps / 2 : NSteps;
+            ASSERT_EQ(var.Steps(), varSteps);
+            ASSERT_EQ(var.Shape().size(), 1);
+            EXPECT_EQ(var.Shape()[0], static_cast<size_t>(mpiSize * Nx));
+            EXPECT_EQ(var.Min(), static_cast<double>(i * 1000));
+            EXPECT_EQ(var.Max(),
+                      static_cast<double>(i * 1000 + (NSteps - 1) * 10 +
+                                          Nx - 1 - ((i % 2) ? 10 : 0)));
+
+            var.SetSelection({{static_cast<size_t>(mpiRank * Nx)}, {Nx}});
+            var.SetStepSelection({varSteps - 1, 1});
+            bpReader.Get(var, data, adios2::Mode::Sync);
+            const size_t lastStep = (i % 2 == 1) ? NSteps - 2 : NSteps - 1;
+            for (size_t j = 0; j < Nx; ++j)
+            {
+                EXPECT_EQ(data[j],
+                          static_cast<double>(i * 1000 + lastStep * 10 + j));
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+TEST_F(BPLargeMetadata, LazyVariables)
+{
+    const std::string fname("BPLargeMetadataLazy.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 10;
+    const std::size_t NSteps = 3;
+    const std::size_t NVars = 50;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+
+        const adios2::Dims shape{static_cast<size_t>(mpiSize * Nx)};
+        const adios2::Dims start{static_cast<size_t>(mpiRank * Nx)};
+        const adios2::Dims count{Nx};
+
+        std::vector<adios2::Variable<int32_t>> varsI32(NVars);
+        for (size_t i = 0; i < NVars; ++i)
+        {
+            varsI32[i] = io.DefineVariable<int32_t>(
+                "varI32_" + std::to_string(i), shape, start, count);
+        }
+        auto varString = io.DefineVariable<std::string>("name");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<int32_t> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t i = 0; i < NVars; ++i)
+            {
+                for (size_t j = 0; j < Nx; ++j)
+                {
+                    data[j] = static_cast<int32_t>(i * 100 + step * 10 + j);
+                }
+                bpWriter.Put(varsI32[i], data.data(), adios2::Mode::Sync);
+            }
+            bpWriter.Put(varString, "step" + std::to_string(step));
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    // random access, a single variable is defined by InquireVariable
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("LazyVariables", "On");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var = io.InquireVariable<int32_t>("varI32_7");
+        EXPECT_TRUE(var);
+        EXPECT_EQ(var.Steps(), NSteps);
+        EXPECT_EQ(var.Min(), 700);
+        EXPECT_EQ(var.Max(), static_cast<int32_t>(700 + (NSteps - 1) * 10 +
+                                                  Nx - 1));
+        EXPECT_FALSE(io.InquireVariable<double>("varI32_8"));
+        EXPECT_FALSE(io.InquireVariable<int32_t>("varI32_missing"));
+        EXPECT_EQ(io.VariableType("varI32_9"), "int32_t");
+
+        std::vector<int32_t> data;
+        var.SetSelection({{static_cast<size_t>(mpiRank * Nx)}, {Nx}});
+        var.SetStepSelection({1, 1});
+        bpReader.Get(var, data, adios2::Mode::Sync);
+        for (size_t j = 0; j < Nx; ++j)
+        {
+            EXPECT_EQ(data[j], static_cast<int32_t>(710 + j));
+        }
+
+        EXPECT_EQ(io.AvailableVariables().size(), NVars + 1);
+        bpReader.Close();
+    }
+
+    // streaming defines all variables at BeginStep
+    {
+        adios2::IO io = adios.DeclareIO("StreamIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("LazyVariables", "On");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        size_t step = 0;
+        std::vector<int32_t> data;
+        std::string name;
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            EXPECT_EQ(io.AvailableVariables().size(), NVars + 1);
+            auto var = io.InquireVariable<int32_t>("varI32_3");
+            EXPECT_TRUE(var);
+            var.SetSelection({{static_cast<size_t>(mpiRank * Nx)}, {Nx}});
+            bpReader.Get(var, data);
+            bpReader.Get(io.InquireVariable<std::string>("name"), name);
+            bpReader.EndStep();
+
+            EXPECT_EQ(name, "step" + std::to_string(step));
+            for (size_t j = 0; j < Nx; ++j)
+            {
+                EXPECT_EQ(data[j], static_cast<int32_t>(300 + step * 10 + j));
+            }
+            ++step;
+        }
+        EXPECT_EQ(step, NSteps);
+        bpReader.Close();
+    }
+}
+
+TEST_F(BPLargeMetadata, MetadataCache)
+{
+    const std::string fname("BPLargeMetadataCache.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 10;
+    const std::size_t NSteps = 4;
+    const std::size_t NVars = 20;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+
+        const adios2::Dims shape{static_cast<size_t>(mpiSize * Nx)};
+        const adios2::Dims start{static_cast<size_t>(mpiRank * Nx)};
+        const adios2::Dims count{Nx};
+
+        std::vector<adios2::Variable<double>> varsR64(NVars);
+        for (size_t i = 0; i < NVars; ++i)
+        {
+            varsR64[i] = io.DefineVariable<double>(
+                "varR64_" + std::to_string(i), shape, start, count);
+        }
+        auto varStep = io.DefineVariable<int32_t>("step");
+        auto varString = io.DefineVariable<std::string>("name");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<double> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t i = 0; i < NVars; ++i)
+            {
+                for (size_t j = 0; j < Nx; ++j)
+                {
+                    data[j] = static_cast<double>(i * 100 + step * 10 + j);
+                }
+                bpWriter.Put(varsR64[i], data.data(), adios2::Mode::Sync);
+            }
+            bpWriter.Put(varStep, static_cast<int32_t>(step));
+            bpWriter.Put(varString, "step" + std::to_string(step));
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    // the first open creates the cache, the second one reads it
+    for (size_t open = 0; open < 2; ++open)
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO" + std::to_string(open));
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("MetadataCache", "On");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        EXPECT_EQ(io.AvailableVariables().size(), NVars + 2);
+
+        auto var = io.InquireVariable<double>("varR64_5");
+        EXPECT_TRUE(var);
+        EXPECT_EQ(var.Steps(), NSteps);
+        EXPECT_EQ(var.Shape().size(), 1);
+        EXPECT_EQ(var.Shape()[0], mpiSize * Nx);
+        EXPECT_EQ(var.Min(), 500.0);
+        EXPECT_EQ(var.Max(),
+                  static_cast<double>(500 + (NSteps - 1) * 10 + Nx - 1));
+        EXPECT_EQ(bpReader.BlocksInfo(var, 2).size(),
+                  static_cast<size_t>(mpiSize));
+
+        std::vector<double> data;
+        var.SetSelection({{static_cast<size_t>(mpiRank * Nx)}, {Nx}});
+        var.SetStepSelection({2, 1});
+        bpReader.Get(var, data, adios2::Mode::Sync);
+        for (size_t j = 0; j < Nx; ++j)
+        {
+            EXPECT_EQ(data[j], static_cast<double>(520 + j));
+        }
+
+        auto varStep = io.InquireVariable<int32_t>("step");
+        EXPECT_TRUE(varStep);
+        EXPECT_EQ(varStep.Steps(), NSteps);
+        EXPECT_EQ(varStep.Min(), 0);
+        EXPECT_EQ(varStep.Max(), static_cast<int32_t>(NSteps - 1));
+
+        auto varString = io.InquireVariable<std::string>("name");
+        EXPECT_TRUE(varString);
+        std::string name;
+        varString.SetStepSelection({3, 1});
+        bpReader.Get(varString, name, adios2::Mode::Sync);
+        EXPECT_EQ(name, "step3");
+
+        bpReader.Close();
+    }
+
+    if (engineName == "BP4")
+    {
+        std::ifstream cacheFile(fname + "/md.cache");
+        EXPECT_TRUE(cacheFile.good());
+    }
+}
+
+TEST_F(BPLargeMetadata, NodeBroadcast)
+{
+    const std::string fname("BPLargeMetadataNodeBroadcast.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 10;
+    const std::size_t NSteps = 5;
+    const std::size_t NVars = 20;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+
+        const adios2::Dims shape{static_cast<size_t>(mpiSize * Nx)};
+        const adios2::Dims start{static_cast<size_t>(mpiRank * Nx)};
+        const adios2::Dims count{Nx};
+
+        std::vector<adios2::Variable<float>> varsR32(NVars);
+        for (size_t i = 0; i < NVars; ++i)
+        {
+            varsR32[i] = io.DefineVariable<float>(
+                "varR32_" + std::to_string(i), shape, start, count);
+        }
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<float> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t i = 0; i < NVars; ++i)
+            {
+                for (size_t j = 0; j < Nx; ++j)
+                {
+                    data[j] = static_cast<float>(i * 100 + step * 10 + j);
+                }
+                bpWriter.Put(varsR32[i], data.data(), adios2::Mode::Sync);
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    // random access
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("NodeBroadcast", "On");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+        EXPECT_EQ(io.AvailableVariables().size(), NVars);
+
+        auto var = io.InquireVariable<float>("varR32_11");
+        EXPECT_TRUE(var);
+        EXPECT_EQ(var.Steps(), NSteps);
+        EXPECT_EQ(var.Min(), 1100.f);
+
+        std::vector<float> data;
+        var.SetSelection({{static_cast<size_t>(mpiRank * Nx)}, {Nx}});
+        var.SetStepSelection({NSteps - 1, 1});
+        bpReader.Get(var, data, adios2::Mode::Sync);
+        for (size_t j = 0; j < Nx; ++j)
+        {
+            EXPECT_EQ(data[j],
+                      static_cast<float>(1100 + (NSteps - 1) * 10 + j));
+        }
+        bpReader.Close();
+    }
+
+    // streaming
+    {
+        adios2::IO io = adios.DeclareIO("StreamIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("NodeBroadcast", "On");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        size_t step = 0;
+        std::vector<float> data;
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<float>("varR32_4");
+            EXPECT_TRUE(var);
+            var.SetSelection({{static_cast<size_t>(mpiRank * Nx)}, {Nx}});
+            bpReader.Get(var, data);
+            bpReader.EndStep();
+
+            for (size_t j = 0; j < Nx; ++j)
+            {
+                EXPECT_EQ(data[j], static_cast<float>(400 + step * 10 + j));
+            }
+            ++step;
+        }
+        EXPECT_EQ(step, NSteps);
+        bpReader.Close();
+    }
+}
+
 int main(int argc, char **argv)
 {
 #if ADIOS2_USE_MPI
@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <tuple>
 
 #include <adios2.h>
 
@@ -16,12 +17,31 @@
 
 std::string engineName; // comes from command line
 
+void SetAggregation(adios2::IO &io, const std::string &aggregationType,
+                    const std::string &assignment)
+{
+    // TwoLevel gathering each node in a shared memory segment
+    if (aggregationType == "TwoLevelSharedMemory")
+    {
+        io.SetParameter("AggregationType", "TwoLevel");
+        io.SetParameter("AggregationSharedMemory", "On");
+    }
+    else
+    {
+        io.SetParameter("AggregationType", aggregationType);
+    }
+    io.SetParameter("SubStreamAssignment", assignment);
+}
+
 // ADIOS2 BP write
-void WriteAggRead1D8(const std::string substreams)
+void WriteAggRead1D8(const std::string substreams,
+                     const std::string aggregationType,
+                     const std::string assignment)
 {
     // Each process would write a 1x8 array and all processes would
     // form a mpiSize * Nx 1D array
-    const std::string fname("BPWriteAggregateRead1D8_" + substreams + ".bp");
+    const std::string fname("BPWriteAggregateRead1D8_" + substreams + "_" +
+                            aggregationType + "_" + assignment + ".bp");
 
     int mpiRank = 0, mpiSize = 1;
     // Number of rows
@@ -37,6 +57,7 @@ void WriteAggRead1D8(const std::string substreams)
     adios2::ADIOS adios(MPI_COMM_WORLD);
     {
         adios2::IO io = adios.DeclareIO("TestIO");
+        SetAggregation(io, aggregationType, assignment);
 
         if (mpiSize > 1)
         {
@@ -325,11 +346,14 @@ void WriteAggRead1D8(const std::string substreams)
     }
 }
 
-void WriteAggRead2D4x2(const std::string substreams)
+void WriteAggRead2D4x2(const std::string substreams,
+                       const std::string aggregationType,
+                       const std::string assignment)
 {
     // Each process would write a 2x4 array and all processes would
     // form a 2D 2 * (numberOfProcess*Nx) matrix where Nx is 4 here
-    const std::string fname("BPWriteAggregateRead2D2x4_" + substreams + ".bp");
+    const std::string fname("BPWriteAggregateRead2D2x4_" + substreams + "_" +
+                            aggregationType + "_" + assignment + ".bp");
 
     int mpiRank = 0, mpiSize = 1;
     // Number of rows
@@ -349,6 +373,7 @@ void WriteAggRead2D4x2(const std::string substreams)
     adios2::ADIOS adios(MPI_COMM_WORLD);
     {
         adios2::IO io = adios.DeclareIO("TestIO");
+        SetAggregation(io, aggregationType, assignment);
 
         if (mpiSize > 1)
         {
@@ -636,11 +661,14 @@ void WriteAggRead2D4x2(const std::string substreams)
     }
 }
 
-void WriteAggRead2D2x4(const std::string substreams)
+void WriteAggRead2D2x4(const std::string substreams,
+                       const std::string aggregationType,
+                       const std::string assignment)
 {
     // Each process would write a 4x2 array and all processes would
     // form a 2D 4 * (NumberOfProcess * Nx) matrix where Nx is 2 here
-    const std::string fname("BPWriteAggregateRead2D4x2_" + substreams + ".bp");
+    const std::string fname("BPWriteAggregateRead2D4x2_" + substreams + "_" +
+                            aggregationType + "_" + assignment + ".bp");
 
     int mpiRank = 0, mpiSize = 1;
     // Number of rows
@@ -658,6 +686,7 @@ void WriteAggRead2D2x4(const std::string substreams)
     adios2::ADIOS adios(MPI_COMM_WORLD);
     {
         adios2::IO io = adios.DeclareIO("TestIO");
+        SetAggregation(io, aggregationType, assignment);
 
         if (mpiSize > 1)
         {
@@ -935,7 +964,9 @@ void WriteAggRead2D2x4(const std::string substreams)
     }
 }
 
-class BPWriteAggregateReadTest : public ::testing::TestWithParam<std::string>
+class BPWriteAggregateReadTest
+: public ::testing::TestWithParam<
+      std::tuple<std::string, std::string, std::string>>
 {
 public:
     BPWriteAggregateReadTest() = default;
@@ -948,21 +979,28 @@ public:
 
 TEST_P(BPWriteAggregateReadTest, ADIOS2BPWriteAggregateRead1D8)
 {
-    WriteAggRead1D8(GetParam());
+    WriteAggRead1D8(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                    std::get<2>(GetParam()));
 }
 
 TEST_P(BPWriteAggregateReadTest, ADIOS2BPWriteAggregateRead2D2x4)
 {
-    WriteAggRead2D2x4(GetParam());
+    WriteAggRead2D2x4(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                      std::get<2>(GetParam()));
 }
 
 TEST_P(BPWriteAggregateReadTest, ADIOS2BPWriteAggregateRead2D4x2)
 {
-    WriteAggRead2D4x2(GetParam());
+    WriteAggRead2D4x2(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                      std::get<2>(GetParam()));
 }
 
-INSTANTIATE_TEST_SUITE_P(Substreams, BPWriteAggregateReadTest,
-                         ::testing::Values("1", "2", "3", "4", "5", "0"));
+INSTANTIATE_TEST_SUITE_P(
+    Substreams, BPWriteAggregateReadTest,
+    ::testing::Combine(::testing::Values("1", "2", "3", "4", "5", "0"),
+                       ::testing::Values("Chain", "TwoLevel",
+                                         "TwoLevelSharedMemory"),
+                       ::testing::Values("Contiguous", "Node", "Balanced")));
 
 int main(int argc, char **argv)
 {
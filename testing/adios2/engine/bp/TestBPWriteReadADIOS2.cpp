@@ -1767,6 +1767,238 @@ TEST_F(BPWriteReadTestADIOS2, ReadStartCount)
     }
 }
 
+TEST_F(BPWriteReadTestADIOS2, AsyncWrite)
+{
+    // Each process writes Nx elements per step with AsyncWrite, with and
+    // without aggregation, with and without exceeding the async buffer size.
+    // Small buffer chunks make aggregators collect data in several chunks.
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 100;
+    const std::size_t NSteps = 5;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+
+    const std::vector<std::string> maxBufferSizes = {"1Gb", "1Kb"};
+    const std::vector<std::string> numAggregators = {
+        "0", std::to_string(mpiSize)};
+
+    for (const auto &maxBufferSize : maxBufferSizes)
+    {
+        for (const auto &aggregators : numAggregators)
+        {
+            const std::string fname("AsyncWrite_" + maxBufferSize + "_" +
+                                    aggregators + ".bp");
+            {
+                adios2::IO io = adios.DeclareIO("Write" + fname);
+                if (!engineName.empty())
+                {
+                    io.SetEngine(engineName);
+                }
+                io.SetParameters({{"AsyncWrite", "On"},
+                                  {"AsyncWriteMaxBufferSize", maxBufferSize},
+                                  {"NumAggregators", aggregators},
+                                  {"BufferChunkSize", "300b"},
+                                  {"BufferChunkHugePages", "On"}});
+
+                adios2::Variable<int64_t> var = io.DefineVariable<int64_t>(
+                    "range", {static_cast<std::size_t>(Nx * mpiSize)},
+                    {static_cast<std::size_t>(Nx * mpiRank)}, {Nx});
+
+                adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+                std::vector<int64_t> localData(Nx);
+                for (size_t step = 0; step < NSteps; ++step)
+                {
+                    std::iota(localData.begin(), localData.end(),
+                              static_cast<int64_t>(step * 1000 + mpiRank * Nx));
+                    bpWriter.BeginStep();
+                    bpWriter.Put(var, localData.data());
+                    bpWriter.EndStep();
+                }
+                bpWriter.Close();
+            }
+
+#if ADIOS2_USE_MPI
+            MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+            {
+                adios2::IO io = adios.DeclareIO("Read" + fname);
+                if (!engineName.empty())
+                {
+                    io.SetEngine(engineName);
+                }
+
+                adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+                adios2::Variable<int64_t> var =
+                    io.InquireVariable<int64_t>("range");
+                ASSERT_TRUE(var);
+                EXPECT_EQ(var.Steps(), NSteps);
+
+                const std::size_t gNx = static_cast<std::size_t>(Nx * mpiSize);
+                std::vector<int64_t> globalData;
+                for (size_t step = 0; step < NSteps; ++step)
+                {
+                    var.SetStepSelection({step, 1});
+                    bpReader.Get(var, globalData, adios2::Mode::Sync);
+                    ASSERT_EQ(globalData.size(), gNx);
+                    for (size_t i = 0; i < gNx; ++i)
+                    {
+                        EXPECT_EQ(globalData[i],
+                                  static_cast<int64_t>(step * 1000 + i));
+                    }
+                }
+                bpReader.Close();
+            }
+        }
+    }
+}
+
+TEST_F(BPWriteReadTestADIOS2, ZeroCopyThreshold)
+{
+    // Large arrays are written from user memory, small ones are copied,
+    // with and without aggregation, with and without flushing every step
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 1000;
+    const std::size_t NSmall = 10;
+    const std::size_t NSteps = 4;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+
+    const std::vector<std::string> numAggregators = {
+        "0", std::to_string(mpiSize)};
+    const std::vector<std::string> flushStepsCounts = {"1", "3"};
+
+    for (const auto &aggregators : numAggregators)
+    {
+        for (const auto &flushStepsCount : flushStepsCounts)
+        {
+            const std::string fname("ZeroCopy_" + aggregators + "_" +
+                                    flushStepsCount + ".bp");
+            {
+                adios2::IO io = adios.DeclareIO("Write" + fname);
+                if (!engineName.empty())
+                {
+                    io.SetEngine(engineName);
+                }
+                io.SetParameters({{"ZeroCopyThreshold", "1Kb"},
+                                  {"NumAggregators", aggregators},
+                                  {"FlushStepsCount", flushStepsCount}});
+
+                const size_t gNx = static_cast<size_t>(Nx * mpiSize);
+                const size_t gNSmall = static_cast<size_t>(NSmall * mpiSize);
+                adios2::Variable<double> varR64 = io.DefineVariable<double>(
+                    "r64", {gNx}, {static_cast<size_t>(Nx * mpiRank)}, {Nx});
+                adios2::Variable<int32_t> varI32 = io.DefineVariable<int32_t>(
+                    "i32", {gNSmall}, {static_cast<size_t>(NSmall * mpiRank)},
+                    {NSmall});
+                adios2::Variable<int64_t> varI64 = io.DefineVariable<int64_t>(
+                    "i64", {gNx}, {static_cast<size_t>(Nx * mpiRank)}, {Nx});
+
+                adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+                std::vector<double> r64(Nx);
+                std::vector<int32_t> i32(NSmall);
+                std::vector<int64_t> i64(Nx);
+                for (size_t step = 0; step < NSteps; ++step)
+                {
+                    std::iota(
+                        r64.begin(), r64.end(),
+                        static_cast<double>(step * 10000 + mpiRank * Nx));
+                    std::iota(i32.begin(), i32.end(),
+                              static_cast<int32_t>(step * 10000 +
+                                                   mpiRank * NSmall));
+                    std::iota(
+                        i64.begin(), i64.end(),
+                        static_cast<int64_t>(step * 10000 + mpiRank * Nx));
+
+                    bpWriter.BeginStep();
+                    bpWriter.Put(varR64, r64.data());
+                    bpWriter.Put(varI32, i32.data());
+                    bpWriter.Put(varI64, i64.data());
+                    bpWriter.EndStep();
+                }
+                bpWriter.Close();
+            }
+
+#if ADIOS2_USE_MPI
+            MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+            {
+                adios2::IO io = adios.DeclareIO("Read" + fname);
+                if (!engineName.empty())
+                {
+                    io.SetEngine(engineName);
+                }
+
+                adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+                adios2::Variable<double> varR64 =
+                    io.InquireVariable<double>("r64");
+                adios2::Variable<int32_t> varI32 =
+                    io.InquireVariable<int32_t>("i32");
+                adios2::Variable<int64_t> varI64 =
+                    io.InquireVariable<int64_t>("i64");
+                ASSERT_TRUE(varR64);
+                ASSERT_TRUE(varI32);
+                ASSERT_TRUE(varI64);
+                EXPECT_EQ(varR64.Steps(), NSteps);
+
+                std::vector<double> r64;
+                std::vector<int32_t> i32;
+                std::vector<int64_t> i64;
+                for (size_t step = 0; step < NSteps; ++step)
+                {
+                    varR64.SetStepSelection({step, 1});
+                    varI32.SetStepSelection({step, 1});
+                    varI64.SetStepSelection({step, 1});
+                    bpReader.Get(varR64, r64);
+                    bpReader.Get(varI32, i32);
+                    bpReader.Get(varI64, i64);
+                    bpReader.PerformGets();
+
+                    ASSERT_EQ(r64.size(), Nx * mpiSize);
+                    ASSERT_EQ(i32.size(), NSmall * mpiSize);
+                    ASSERT_EQ(i64.size(), Nx * mpiSize);
+                    for (size_t i = 0; i < r64.size(); ++i)
+                    {
+                        EXPECT_EQ(r64[i],
+                                  static_cast<double>(step * 10000 + i));
+                        EXPECT_EQ(i64[i],
+                                  static_cast<int64_t>(step * 10000 + i));
+                    }
+                    for (size_t i = 0; i < i32.size(); ++i)
+                    {
+                        EXPECT_EQ(i32[i],
+                                  static_cast<int32_t>(step * 10000 + i));
+                    }
+                }
+                bpReader.Close();
+            }
+        }
+    }
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
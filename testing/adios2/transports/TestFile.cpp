@@ -3,8 +3,10 @@
  * accompanying file Copyright.txt for details.
  */
 #include <array>
+#include <fstream>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include <adios2.h>
 
@@ -76,6 +78,132 @@ TEST_P(BufferTest, WriteRead)
 }
 
 #ifdef __unix__
+TEST(FileTest, DirectIO)
+{
+    const std::string fname("FileDirectIOTest.bp");
+    // odd sizes so that data and metadata are never aligned by themselves
+    const size_t nx = 1001;
+    const size_t steps = 3;
+
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        io.SetEngine("BP4");
+        const size_t transportID = io.AddTransport("file");
+        io.SetTransportParameter(transportID, "Library", "posix");
+        io.SetTransportParameter(transportID, "DirectIO", "true");
+
+        auto var = io.DefineVariable<double>("var", {nx}, {0}, {nx});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<double> data(nx);
+        for (size_t step = 0; step < steps; ++step)
+        {
+            for (size_t i = 0; i < nx; ++i)
+            {
+                data[i] = static_cast<double>(step * nx + i);
+            }
+            writer.BeginStep();
+            writer.Put(var, data.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("BP4");
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+
+        std::vector<double> data;
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<double>("var");
+            ASSERT_TRUE(var);
+            reader.Get(var, data, adios2::Mode::Sync);
+            ASSERT_EQ(data.size(), nx);
+            for (size_t i = 0; i < nx; ++i)
+            {
+                ASSERT_EQ(data[i], static_cast<double>(step * nx + i));
+            }
+            reader.EndStep();
+            ++step;
+        }
+        EXPECT_EQ(step, steps);
+        reader.Close();
+    }
+}
+
+TEST(FileTest, Striped)
+{
+    const std::string fname("FileStripedTest.bp");
+    const size_t nx = 1001;
+    const size_t steps = 3;
+
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        io.SetEngine("BP4");
+        const size_t transportID = io.AddTransport("file");
+        io.SetTransportParameter(transportID, "Library", "stripe");
+        io.SetTransportParameter(transportID, "StripeCount", "3");
+        io.SetTransportParameter(transportID, "StripeSize", "1Kb");
+        io.SetTransportParameter(transportID, "StripeDirs",
+                                 "FileStripedTest.d0,FileStripedTest.d1");
+
+        auto var = io.DefineVariable<double>("var", {nx}, {0}, {nx});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<double> data(nx);
+        for (size_t step = 0; step < steps; ++step)
+        {
+            for (size_t i = 0; i < nx; ++i)
+            {
+                data[i] = static_cast<double>(step * nx + i);
+            }
+            writer.BeginStep();
+            writer.Put(var, data.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+    // stripes go round-robin to the directories
+    for (const std::string stripe :
+         {"FileStripedTest.d0/FileStripedTest.bp/data.0.stripe0",
+          "FileStripedTest.d1/FileStripedTest.bp/data.0.stripe1",
+          "FileStripedTest.d0/FileStripedTest.bp/data.0.stripe2"})
+    {
+        EXPECT_TRUE(std::ifstream(stripe).good()) << stripe;
+    }
+
+    // the reader finds the stripes without transport parameters
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("BP4");
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+
+        std::vector<double> data;
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<double>("var");
+            ASSERT_TRUE(var);
+            reader.Get(var, data, adios2::Mode::Sync);
+            ASSERT_EQ(data.size(), nx);
+            for (size_t i = 0; i < nx; ++i)
+            {
+                ASSERT_EQ(data[i], static_cast<double>(step * nx + i));
+            }
+            reader.EndStep();
+            ++step;
+        }
+        EXPECT_EQ(step, steps);
+        reader.Close();
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TransportTests, BufferTest,
     ::testing::Values(std::make_tuple("fstream", "true", "posix", "false"),
@@ -87,6 +215,9 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("posix", "false", "posix", "false"),
                       std::make_tuple("stdio", "true", "posix", "false"),
                       std::make_tuple("stdio", "false", "posix", "false"),
+                      std::make_tuple("posix", "false", "mmap", "false"),
+                      std::make_tuple("stdio", "true", "mmap", "false"),
+                      std::make_tuple("fstream", "true", "mmap", "false"),
 
                       std::make_tuple("stdio", "true", "stdio", "true"),
                       std::make_tuple("stdio", "true", "stdio", "false"),
@@ -127,6 +258,15 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("fstream", "false", "fstream", "false")));
 #endif
 
+#ifdef ADIOS2_HAVE_AIO
+INSTANTIATE_TEST_SUITE_P(
+    AIOTransportTests, BufferTest,
+    ::testing::Values(std::make_tuple("aio", "false", "aio", "false"),
+                      std::make_tuple("aio", "false", "posix", "false"),
+                      std::make_tuple("posix", "false", "aio", "false"),
+                      std::make_tuple("stdio", "true", "aio", "false")));
+#endif
+
 int main(int argc, char **argv)
 {
     int result;